@@ -12,6 +12,7 @@
 #include <stdint.h>
 
 #include "znet_defs.h"
+#include "znet_config.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -86,6 +87,32 @@ typedef struct znet_nodeinfo_t
     znet_command_class_t commands[]; /**< Commands classes, max 35 */
 } znet_nodeinfo_t;
 
+/**
+ * @brief Max number of command classes in node info
+ */
+#define ZNET_NODEINFO_COMMANDS_MAX 35
+
+/**
+ * @brief Node info of fixed capacity, see znet_node_info_all
+ *
+ * Same layout as znet_nodeinfo_t, a pointer to record can be used as
+ * const znet_nodeinfo_t*.
+ */
+typedef struct znet_nodeinfo_record_t
+{
+    uint8_t __ver;                   /**< reserved */
+    znet_node_id_t node_id;          /**< Node ID */
+    uint8_t __0;                     /**< reserved for capa */
+    uint8_t __1;                     /**< reserved for sec */
+    uint8_t __2;                     /**< reserved */
+    znet_basic_class_t basic;        /**< Basic class type */
+    znet_generic_class_t generic;    /**< Generic class type */
+    znet_specific_class_t specific;  /**< Specific class type */
+    uint8_t commands_count;          /**< Commands classes count */
+    znet_command_class_t commands[ZNET_NODEINFO_COMMANDS_MAX]; /**< Commands
+                                                                  classes */
+} znet_nodeinfo_record_t;
+
 /**
  * @brief Function prototype for allocate/reallocate/freed block memmory
  *
@@ -157,6 +184,9 @@ typedef void ( *ZNET_LOG )( int lvl, const char* fmt, va_list list, void* arg );
  * size != 0, ret_size = <ptr> For write call is blocked if all data can
  * not be written to uart buffer
  *
+ * In ZNET_UART_MODE_NONBLOCKING the size never exceeds the free space
+ * returned by use case 1, so the call does not block.
+ *
  * @param data Pointer to buffer with data
  * @param size The size of the data for write
  * @param ret_size Return free size in uart buffer or param size (see use cases)
@@ -750,6 +780,38 @@ typedef struct znet_configuration_bulk_report_t
     uint8_t data[];                             /**< Configuration Data */
 } znet_configuration_bulk_report_t;
 
+/**
+ * @brief Decoded value of configuration parameter
+ */
+typedef union znet_cmd_configuration_decoded_t
+{
+    int32_t s;  /**< Signed format, sign extended */
+    uint32_t u; /**< Unsigned, enumerated and bit field formats */
+} znet_cmd_configuration_decoded_t;
+
+/**
+ * @brief Configuration Bulk Report with values decoded to host integers
+ *
+ * Format of every parameter is taken from its properties metadata. Parameters
+ * without known properties are signed (Configuration Command Class v1-2).
+ */
+typedef struct znet_configuration_bulk_values_t
+{
+    uint8_t __ver;                            /**< reserved */
+    znet_cmd_configuration_id_t param_offset; /**< Parameter Offset */
+    uint8_t param_number;                     /**< Parameter Number */
+    uint8_t rep_to_follows;                   /**< Report to follows */
+    uint8_t data_count;                       /**< Size of the actual parameter. */
+    uint8_t signed_map[32];                   /**< bit: value i is signed */
+    znet_cmd_configuration_decoded_t values[]; /**< Values */
+} znet_configuration_bulk_values_t;
+
+/**
+ * @brief Check value i of decoded bulk report is signed (read .s, else .u)
+ */
+#define ZNET_CONFIGURATION_BULK_IS_SIGNED( report, i ) \
+    ( ( ( report )->signed_map[( i ) >> 3] >> ( ( i ) & 7 ) ) & 1 )
+
 /**
  * @brief  Command Class, versions 3-4: Configuration Name Report
  */
@@ -758,7 +820,7 @@ typedef struct znet_configuration_name_report_t
     uint8_t __ver;                              /**< reserved */
     znet_cmd_configuration_id_t param_number;   /**< Parameter Number */
     uint8_t rep_to_follows;                     /**< Report to follows */
-    uint8_t data[];                             /**< Configuration Data */
+    uint8_t data[];                             /**< Name, zero terminated */
 } znet_configuration_name_report_t;
 
 /**
@@ -769,7 +831,7 @@ typedef struct znet_configuration_info_report_t
     uint8_t __ver;                              /**< reserved */
     znet_cmd_configuration_id_t param_number;   /**< Parameter Number */
     uint8_t rep_to_follows;                     /**< Report to follows */
-    uint8_t data[];                             /**< Configuration Data */
+    uint8_t data[];                             /**< Info, zero terminated */
 } znet_configuration_info_report_t;
 
 /**
@@ -781,15 +843,53 @@ typedef struct znet_configuration_properties_report_t
     znet_cmd_configuration_id_t param_number;   /**< Parameter Number */
     uint8_t data_format;                        /**< Format of the actual parameter. */
     uint8_t data_size;                          /**< Size of the actual parameter. */
-    uint8_t data[];                             /**< Configuration Data */
+    znet_cmd_configuration_id_t next_param;     /**< Next Parameter Number */
+    uint8_t data[]; /**< Properties1, Min Value, Max Value, Default Value
+                       (data_size bytes each), Next Parameter Number */
 } znet_configuration_properties_report_t;
 
+/**
+ * @brief Configuration parameter format
+ */
+#define ZNET_CMD_CONFIGURATION_FORMAT_SIGNED        0x00
+#define ZNET_CMD_CONFIGURATION_FORMAT_UNSIGNED      0x01
+#define ZNET_CMD_CONFIGURATION_FORMAT_ENUMERATED    0x02
+#define ZNET_CMD_CONFIGURATION_FORMAT_BIT_FIELD     0x03
+
+/**
+ * @brief Configuration parameter metadata: known parts
+ */
+#define ZNET_PARAM_META_PROPERTIES  0x01
+#define ZNET_PARAM_META_NAME        0x02
+#define ZNET_PARAM_META_INFO        0x04
+
+#define ZNET_PARAM_META_NAME_MAX    48
+#define ZNET_PARAM_META_INFO_MAX    128
+
+/**
+ * @brief Configuration parameter metadata, shared by identical device models
+ */
+typedef struct znet_param_meta_t
+{
+    znet_cmd_configuration_id_t param_number;   /**< Parameter Number */
+    znet_cmd_configuration_id_t next_param;     /**< Next Parameter Number */
+    uint8_t flags;                              /**< ZNET_PARAM_META_* */
+    uint8_t data_format;                        /**< Format of the parameter */
+    uint8_t data_size;                          /**< Size of the parameter */
+    int32_t min_value;                          /**< Min Value */
+    int32_t max_value;                          /**< Max Value */
+    int32_t default_value;                      /**< Default Value */
+    char name[ZNET_PARAM_META_NAME_MAX];        /**< Name, UTF-8 */
+    char info[ZNET_PARAM_META_INFO_MAX];        /**< Info, UTF-8 */
+} znet_param_meta_t;
+
 /**
  * @brief Function prototype for notify: node cmd configuration report/result
  *
  * @param err Return zero on success. On error, other value is returned.
  * @param node_id Node ID
- * @param value Current configuration value
+ * @param value Current configuration value. On error the Parameter Number of
+ * the failed Get or Set (with the value of the Set), NULL for Default Reset
  * @param arg Parameter for callback functions
  */
 typedef void ( *ZNET_NODE_CMD_CONFIGURATION_RESULT )(
@@ -801,19 +901,34 @@ typedef void ( *ZNET_NODE_CMD_CONFIGURATION_RESULT )(
  *
  * @param err Return zero on success. On error, other value is returned.
  * @param node_id Node ID
- * @param value Current configuration value
+ * @param value Current configuration value. On error the Parameter Offset and
+ * count of the failed Bulk Get or Bulk Set, without data
  * @param arg Parameter for callback functions
  */
 typedef void ( *ZNET_NODE_CMD_CONFIGURATION_BULK_RESULT )(
     int err, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
     const znet_configuration_bulk_report_t* value, void* arg );
 
+ /**
+ * @brief Function prototype for notify: node cmd configuration bulk report
+ * with decoded values
+ *
+ * @param err Return zero on success. On error, other value is returned.
+ * @param node_id Node ID
+ * @param value Decoded configuration values
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_NODE_CMD_CONFIGURATION_BULK_VALUES_RESULT )(
+    int err, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    const znet_configuration_bulk_values_t* value, void* arg );
+
  /**
  * @brief Function prototype for notify: node cmd configuration name report/result
  *
  * @param err Return zero on success. On error, other value is returned.
  * @param node_id Node ID
- * @param value Current configuration value
+ * @param value Current configuration value. On error the Parameter Number of
+ * the failed Get, without text
  * @param arg Parameter for callback functions
  */
 typedef void ( *ZNET_NODE_CMD_CONFIGURATION_NAME_RESULT )(
@@ -825,25 +940,229 @@ typedef void ( *ZNET_NODE_CMD_CONFIGURATION_NAME_RESULT )(
  *
  * @param err Return zero on success. On error, other value is returned.
  * @param node_id Node ID
- * @param value Current configuration value
+ * @param value Current configuration value. On error the Parameter Number of
+ * the failed Get, without text
  * @param arg Parameter for callback functions
  */
 typedef void ( *ZNET_NODE_CMD_CONFIGURATION_INFO_RESULT )(
     int err, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
     const znet_configuration_info_report_t* value, void* arg );
 
+/**
+ * @brief  Configuration parameters of node, ordered by Parameter Number
+ */
+typedef struct znet_configuration_walk_report_t
+{
+    uint8_t __ver;                              /**< reserved */
+    uint16_t count;                             /**< Parameters count */
+    znet_param_meta_t params[];                 /**< Parameters */
+} znet_configuration_walk_report_t;
+
  /**
  * @brief Function prototype for notify: node cmd configuration info report/result
  *
  * @param err Return zero on success. On error, other value is returned.
  * @param node_id Node ID
- * @param config_value Current configuration value
+ * @param config_value Current configuration value. On error the Parameter
+ * Number of the failed Get, without properties
  * @param arg Parameter for callback functions
  */
 typedef void ( *ZNET_NODE_CMD_CONFIGURATION_PROPERTIES_RESULT )(
     int err, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
     const znet_configuration_properties_report_t* value, void* arg );
 
+ /**
+ * @brief Function prototype for notify: node cmd configuration walk result
+ *
+ * On error value contains parameters found before the error or is NULL.
+ *
+ * @param err Return zero on success. On error, other value is returned.
+ * @param node_id Node ID
+ * @param value All configuration parameters of node
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_NODE_CMD_CONFIGURATION_WALK_RESULT )(
+    int err, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    const znet_configuration_walk_report_t* value, void* arg );
+
+/**
+ * @brief Format of serialized configuration backup
+ */
+#define ZNET_CONFIGURATION_BACKUP_FORMAT 0x01
+
+/**
+ * @brief  Configuration backup of node
+ *
+ * data[0] is ZNET_CONFIGURATION_BACKUP_FORMAT, runs of parameters follow.
+ * A run is parameters with consecutive numbers and the same size, as in
+ * Bulk Report: Parameter Offset (2 bytes, MSB first), Number of Parameters
+ * (1 byte), Size (1 byte), then the values (Size bytes each, MSB first).
+ */
+typedef struct znet_configuration_backup_report_t
+{
+    uint8_t __ver;                              /**< reserved */
+    uint16_t count;                             /**< Parameters count */
+    uint16_t size;                              /**< Size of data */
+    uint8_t data[];                             /**< Serialized parameters */
+} znet_configuration_backup_report_t;
+
+ /**
+ * @brief Function prototype for notify: node cmd configuration backup result
+ *
+ * The backup is valid only during the call, copy value->data to keep it.
+ *
+ * @param err Return zero on success. On error, other value is returned.
+ * @param node_id Node ID
+ * @param value Backup or NULL on error
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_NODE_CMD_CONFIGURATION_BACKUP_RESULT )(
+    int err, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    const znet_configuration_backup_report_t* value, void* arg );
+
+/**
+ * @brief  Result of configuration restore
+ */
+typedef struct znet_configuration_restore_report_t
+{
+    uint8_t __ver;                              /**< reserved */
+    uint16_t count;                             /**< Parameters in backup */
+    uint16_t changed;                           /**< Parameters written */
+    uint16_t frames;                            /**< Sets sent */
+} znet_configuration_restore_report_t;
+
+ /**
+ * @brief Function prototype for notify: node cmd configuration restore result
+ *
+ * @param err Return zero on success. On error, other value is returned.
+ * @param node_id Node ID
+ * @param value Result or NULL if values of node were not read
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_NODE_CMD_CONFIGURATION_RESTORE_RESULT )(
+    int err, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    const znet_configuration_restore_report_t* value, void* arg );
+
+/**
+ * @brief Health of node
+ */
+typedef struct znet_node_health_t
+{
+    uint8_t failed;        /**< flag: node is failed, commands are rejected */
+    uint8_t failures;      /**< Lost reports in a row */
+    uint64_t last_contact; /**< Time of last report (ms, see clock), 0 - never */
+    uint64_t next_probe;   /**< Time of next probe when failed (ms) */
+    uint32_t rejected;     /**< Commands rejected while failed */
+} znet_node_health_t;
+
+/**
+ * @brief Function prototype for notify: node failed or recovered
+ *
+ * @param err Always zero
+ * @param node_id Node ID
+ * @param value Health of node, value->failed tells the new state
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_NODE_HEALTH_RESULT )( int err, znet_node_id_t node_id,
+                                           const znet_node_health_t* value,
+                                           void* arg );
+
+/**
+ * @brief Steps of background interview (flags)
+ */
+#define ZNET_INTERVIEW_VERSION 0x01       /**< Version Get */
+#define ZNET_INTERVIEW_MANUFACTURER 0x02  /**< Manufacturer Specific Get */
+#define ZNET_INTERVIEW_ZWAVEPLUS 0x04     /**< Z-Wave Plus Info Get */
+#define ZNET_INTERVIEW_MULTICHANNEL 0x08  /**< Multi Channel End Point Get */
+#define ZNET_INTERVIEW_CONFIGURATION 0x10 /**< Configuration discovery */
+#define ZNET_INTERVIEW_ALL 0x1F
+
+/**
+ * @brief Progress of background interview
+ */
+typedef struct znet_interview_progress_t
+{
+    uint8_t step;    /**< Step finished, 0 - interview finished */
+    uint8_t done;    /**< Steps answered by the node */
+    uint8_t failed;  /**< Steps without answer */
+    uint8_t pending; /**< Steps left */
+    uint16_t queued; /**< Nodes waiting for their interview */
+} znet_interview_progress_t;
+
+/**
+ * @brief Function prototype for notify: step of background interview finished
+ *
+ * Called after every step and once more with step 0 when the interview of
+ * node is finished. Reports of the steps go to their own result callbacks.
+ *
+ * @param err Zero if the step (interview) succeeded. On error, -1 is returned
+ * @param node_id Node ID
+ * @param value Progress
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_NODE_INTERVIEW_RESULT )(
+    int err, znet_node_id_t node_id, const znet_interview_progress_t* value,
+    void* arg );
+
+/**
+ * @brief Library context
+ *
+ * Holds all state of one controller. The API without explicit context
+ * operates on the context created by znet_init.
+ */
+typedef struct znet_ctx_t znet_ctx_t;
+
+/**
+ * @brief Pooled event: result/report waiting for delivery
+ */
+typedef struct znet_event_t znet_event_t;
+
+/**
+ * @brief Function prototype for executor of offloaded result callbacks
+ *
+ * Called from znet_proc with an event ready for delivery. The executor must
+ * call znet_event_run( event ) exactly once, from any thread. The event
+ * returns to the pool after that.
+ *
+ * @param event Event
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_DISPATCH_EXECUTOR )( znet_event_t* event, void* arg );
+
+/**
+ * @brief Staged store writes, see znet_ctx_store_mode
+ */
+typedef struct znet_store_batch_t znet_store_batch_t;
+
+/**
+ * @brief Function prototype for executor of store writes
+ *
+ * Called from znet_proc with a batch of writes. The executor must call
+ * znet_store_batch_run( batch ) exactly once, from any thread (e.g. a worker
+ * doing the disk IO). The next batch is handed over after that.
+ *
+ * znet_ctx_free and znet_ctx_store_flush wait for the batch being written.
+ * Without store_wait the executor must finish it on its own thread: a batch
+ * queued for the waiting thread is never run.
+ *
+ * @param batch Batch of writes
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_STORE_EXECUTOR )( znet_store_batch_t* batch, void* arg );
+
+/**
+ * @brief Function prototype for wait of store executor
+ *
+ * Called by znet_ctx_free and znet_ctx_store_flush while a batch handed to
+ * store_executor is not written yet. Required for async mode when the C
+ * library has no threads (__STDC_NO_THREADS__). Returns when znet_store_batch_run( batch ) has returned, e.g.
+ * joins the worker or runs the queued batch in place.
+ *
+ * @param batch Batch being written
+ * @param arg Parameter for callback functions
+ */
+typedef void ( *ZNET_STORE_WAIT )( znet_store_batch_t* batch, void* arg );
+
 /**
  * @brief TBD.
  */
@@ -851,7 +1170,8 @@ typedef struct znet_callbacks_t
 {
     void* arg; /**< Parameter for callback functions */
 
-    ZNET_ALLOC alloc; /**< Func for memmory management [req] */
+    ZNET_ALLOC alloc; /**< Func for memmory management [req], not used with
+                         ZNET_CFG_STATIC_MEMORY [opt] */
     ZNET_CLOCK clock; /**< Func for get monotonic time [req] */
     ZNET_LOG log;     /**< Func for logging [req] */
 
@@ -872,37 +1192,54 @@ typedef struct znet_callbacks_t
     ZNET_NODE_LIST_RESULT
     node_list_result; /**< Func for async result of node_list [opt] */
 
+#if ZNET_CFG_CC_VERSION
     ZNET_NODE_CMD_VERSION_RESULT
     node_cmd_version_result; /**< Function for async result/report of
                                 cmd_version [opt] */
     ZNET_NODE_CMD_COMMAND_VERSION_RESULT
     node_cmd_command_version_result; /**< Function for async result/report of
                                         cmd_command_version [opt] */
+#endif  // ZNET_CFG_CC_VERSION
+#if ZNET_CFG_CC_MANUFACTURER_SPECIFIC
     ZNET_NODE_CMD_MANUFACTURER_SPECIFIC_RESULT
     node_cmd_manufacturer_specific_result; /**< Function for async result/report
                                               of cmd_manufacturer_specific [opt]
                                             */
+#endif  // ZNET_CFG_CC_MANUFACTURER_SPECIFIC
+#if ZNET_CFG_CC_DEVICE_SPECIFIC
     ZNET_NODE_CMD_DEVICE_SPECIFIC_RESULT
     node_cmd_device_specific_result; /**< Function for async result/report of
                                               cmd_device_specific [opt] */
+#endif  // ZNET_CFG_CC_DEVICE_SPECIFIC
+#if ZNET_CFG_CC_ZWAVEPLUS_INFO
     ZNET_NODE_CMD_ZWAVEPLUS_INFO_RESULT
     node_cmd_zwaveplus_info_result; /**< Function for async result/report of
                                        cmd_zwaveplus_info [opt] */
+#endif  // ZNET_CFG_CC_ZWAVEPLUS_INFO
+#if ZNET_CFG_CC_BASIC
     ZNET_NODE_CMD_BASIC_RESULT
     node_cmd_basic_result; /**< Func for async result/report of cmd_basic [opt]
                             */
+#endif  // ZNET_CFG_CC_BASIC
+#if ZNET_CFG_CC_BINARY_SWITCH
     ZNET_NODE_CMD_BINARY_SWITCH_RESULT
     node_cmd_binary_switch_result; /**< Func for async result/report of
                                       cmd_binary_switch [opt] */
+#endif  // ZNET_CFG_CC_BINARY_SWITCH
+#if ZNET_CFG_CC_METER
     ZNET_NODE_CMD_METER_RESULT
     node_cmd_meter_result; /**< Func for async result/report of cmd_meter [opt]
                             */
     ZNET_NODE_CMD_METER_SUPPORTED_RESULT
     node_cmd_meter_supported_result; /**< Func for async result/report of
                                         cmd_meter_supported [opt] */
+#endif  // ZNET_CFG_CC_METER
+#if ZNET_CFG_CC_MULTILEVEL_SWITCH
     ZNET_NODE_CMD_MULTILEVEL_SWITCH_RESULT
     node_cmd_multilevel_switch_result; /**< Func for async result/report of
                                       cmd_multilevel_switch [opt] */
+#endif  // ZNET_CFG_CC_MULTILEVEL_SWITCH
+#if ZNET_CFG_CC_MULTICHANNEL
     ZNET_NODE_CMD_MULTICHANNEL_ENDPOINT_RESULT
     node_cmd_multichannel_endpoint_result; /**< Func for async result/report of
                                                 cmd_multichannel_endpoint [opt]
@@ -921,12 +1258,17 @@ typedef struct znet_callbacks_t
                                                 result/report of
                                                 cmd_multichannel_aggregated_members
                                                 [opt] */
+#endif  // ZNET_CFG_CC_MULTICHANNEL
+#if ZNET_CFG_CC_CONFIGURATION
     ZNET_NODE_CMD_CONFIGURATION_RESULT
     node_cmd_configuration_result; /**< Func for async result/report of
                                       cmd_configiration [opt] */
     ZNET_NODE_CMD_CONFIGURATION_BULK_RESULT
     node_cmd_configuration_bulk_result; /**< Func for async result/report of
                                       cmd_configiration_bulk [opt] */
+    ZNET_NODE_CMD_CONFIGURATION_BULK_VALUES_RESULT
+    node_cmd_configuration_bulk_values_result; /**< Func for decoded report of
+                                      cmd_configiration_bulk [opt] */
     ZNET_NODE_CMD_CONFIGURATION_NAME_RESULT
     node_cmd_configuration_name_result; /**< Func for async result/report of
                                       cmd_configiration_name [opt] */
@@ -936,12 +1278,36 @@ typedef struct znet_callbacks_t
     ZNET_NODE_CMD_CONFIGURATION_PROPERTIES_RESULT
     node_cmd_configuration_properties_result; /**< Func for async result/report of
                                       cmd_configiration_properties [opt] */
+    ZNET_NODE_CMD_CONFIGURATION_WALK_RESULT
+    node_cmd_configuration_walk_result; /**< Func for async result of
+                                      cmd_configiration_walk [opt] */
+    ZNET_NODE_CMD_CONFIGURATION_BACKUP_RESULT
+    node_cmd_configuration_backup_result; /**< Func for async result of
+                                      cmd_configiration_backup [opt] */
+    ZNET_NODE_CMD_CONFIGURATION_RESTORE_RESULT
+    node_cmd_configuration_restore_result; /**< Func for async result of
+                                      cmd_configiration_restore [opt] */
+#endif  // ZNET_CFG_CC_CONFIGURATION
+    ZNET_NODE_HEALTH_RESULT
+    node_health_result; /**< Func for notify of failed/recovered node [opt] */
+    ZNET_NODE_INTERVIEW_RESULT
+    node_interview_result; /**< Func for progress of interview [opt] */
+    ZNET_DISPATCH_EXECUTOR
+    dispatch_executor; /**< Func for run result callbacks out of znet_proc,
+                          see znet_ctx_dispatch_mode [opt] */
+    ZNET_STORE_EXECUTOR
+    store_executor; /**< Func for run store writes out of znet_proc, see
+                       znet_ctx_store_mode [opt] */
+    ZNET_STORE_WAIT
+    store_wait; /**< Func for wait of store_executor in znet_ctx_free [opt] */
     /// TODO: to declare others callback functions
 } znet_callbacks_t;
 
 /**
  * @brief Init znet library
  *
+ * Creates the default context used by the API without explicit context.
+ *
  * @param Callbacks. Do not delete the znet_callbacks_t structure while using
  * the library!!!
  * @return Return zero on success. On error, -1 is returned
@@ -963,6 +1329,388 @@ int znet_init( const znet_callbacks_t* callbacks );
  */
 void znet_proc( void );
 
+/**
+ * @brief Create library context
+ *
+ * Every context drives its own controller and does not share state with
+ * other contexts, so contexts can be processed from different threads.
+ *
+ * @param Callbacks. Do not delete the znet_callbacks_t structure while using
+ * the context!!!
+ * @return Context on success. On error, NULL is returned
+ */
+znet_ctx_t* znet_ctx_init( const znet_callbacks_t* callbacks );
+
+/**
+ * @brief Get the default context created by znet_init
+ *
+ * @return Context or NULL if the library is not initialized
+ */
+znet_ctx_t* znet_ctx_get_default( void );
+
+/**
+ * @brief Main handler of the context, see znet_proc
+ *
+ * @param ctx Context
+ */
+void znet_ctx_proc( znet_ctx_t* ctx );
+
+/**
+ * @brief Release library context
+ *
+ * @param ctx Context
+ */
+void znet_ctx_free( znet_ctx_t* ctx );
+
+/**
+ * @brief Memory used by the library (bytes)
+ */
+typedef struct znet_memory_report_t
+{
+    size_t context;      /**< One context, including all below */
+    size_t queues;       /**< Transmit, requests, dispatch with its pool of big
+                            reports and held commands */
+    size_t nodes;        /**< Tables of nodes: round-trip, state, subscriptions */
+    size_t param_db;     /**< Pools of parameters metadata, 0 - ZNET_ALLOC */
+    size_t walks;        /**< Pools of configuration discovery, 0 - ZNET_ALLOC */
+    size_t backups;      /**< Pools of configuration backup, 0 - ZNET_ALLOC */
+    size_t meter_series; /**< Pools of meter history, 0 - ZNET_ALLOC */
+    size_t total;        /**< All contexts with ZNET_CFG_STATIC_MEMORY, else one
+                            context without blocks of ZNET_ALLOC */
+} znet_memory_report_t;
+
+/**
+ * @brief Get worst-case memory usage of the build
+ *
+ * With ZNET_CFG_STATIC_MEMORY the library does not allocate, the total is
+ * all the memory it ever uses (stack excluded).
+ *
+ * @param report Usage
+ */
+void znet_memory_report( znet_memory_report_t* report );
+
+/**
+ * @brief Owner of memory, see znet_ctx_mem_stats
+ */
+typedef enum znet_mem_tag_t {
+    ZNET_MEM_TAG_CONTEXT = 0,   /**< Context: queues, node tables, requests */
+    ZNET_MEM_TAG_PARAM_MODELS,  /**< Models of parameters metadata */
+    ZNET_MEM_TAG_PARAM_PARAMS,  /**< Parameters metadata of models */
+    ZNET_MEM_TAG_WALK,          /**< Reports of configuration discovery */
+    ZNET_MEM_TAG_BACKUP,        /**< Configuration backups and restores */
+    ZNET_MEM_TAG_METER_RING,    /**< Raw samples of meter series */
+    ZNET_MEM_TAG_METER_ROLLUP,  /**< Rollups of meter series */
+    ZNET_MEM_TAG_DISPATCH,      /**< Reports too big for a dispatch event */
+
+    ZNET_MEM_TAG_COUNT /**< Number of tags, keep last */
+} znet_mem_tag_t;
+
+/**
+ * @brief Memory counters of one owner
+ */
+typedef struct znet_mem_stats_t
+{
+    size_t live;       /**< Bytes allocated now */
+    size_t high_water; /**< Max of live bytes */
+    uint32_t allocs;   /**< Blocks allocated */
+    uint32_t frees;    /**< Blocks freed */
+    uint32_t failures; /**< Failed allocations */
+} znet_mem_stats_t;
+
+/**
+ * @brief Get memory counters of owner
+ *
+ * Every block the library takes from ZNET_ALLOC (or the static pools) is
+ * counted by its owner. Call from the thread of znet_proc.
+ *
+ * @param ctx Context
+ * @param tag Owner
+ * @param stats Counters
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_mem_stats( znet_ctx_t* ctx, znet_mem_tag_t tag,
+                        znet_mem_stats_t* stats );
+
+/**
+ * @brief Dispatch modes of result callbacks
+ */
+#define ZNET_DISPATCH_MODE_INLINE 0   /**< Run inside znet_proc (default) */
+#define ZNET_DISPATCH_MODE_EXECUTOR 1 /**< Hand over to dispatch_executor */
+#define ZNET_DISPATCH_MODE_QUEUE 2    /**< Queue for znet_ctx_dispatch_drain */
+
+/**
+ * @brief Behaviour when event pool is exhausted
+ *
+ * A report too big for an event (192 bytes), e.g. a result of configuration
+ * discovery, backup or a Bulk Report, is copied into a buffer of the event
+ * (ZNET_MEM_TAG_DISPATCH). The buffer is released by znet_proc after the
+ * callback. If it can not be allocated the report is handled as if the pool
+ * were full.
+ */
+#define ZNET_DISPATCH_FULL_DROP 0   /**< Drop the report, count overflow */
+#define ZNET_DISPATCH_FULL_INLINE 1 /**< Run the callback inside znet_proc */
+
+/**
+ * @brief Dispatcher counters
+ */
+typedef struct znet_dispatch_stats_t
+{
+    uint32_t pending;    /**< Events waiting for delivery */
+    uint32_t queued;     /**< Events handed over */
+    uint32_t delivered;  /**< Events delivered */
+    uint32_t inlined;    /**< Callbacks run inline due to full pool */
+    uint32_t overflow;   /**< Reports dropped due to full pool */
+    uint32_t high_water; /**< Max events pending at the same time */
+} znet_dispatch_stats_t;
+
+/**
+ * @brief Select dispatch mode of result callbacks
+ *
+ * In executor and queue modes reports are copied into pooled events, so a slow
+ * callback does not stall znet_proc. Change the mode when no events are
+ * pending.
+ *
+ * @param ctx Context
+ * @param mode ZNET_DISPATCH_MODE_*
+ * @param full_policy ZNET_DISPATCH_FULL_*
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_dispatch_mode( znet_ctx_t* ctx, int mode, int full_policy );
+
+/**
+ * @brief Deliver event to the user callback and return it to the pool
+ *
+ * @param event Event passed to the executor
+ */
+void znet_event_run( znet_event_t* event );
+
+/**
+ * @brief Deliver queued events (ZNET_DISPATCH_MODE_QUEUE)
+ *
+ * Single consumer: call from one thread, it may differ from the thread of
+ * znet_proc.
+ *
+ * @param ctx Context
+ * @param max Max events to deliver
+ * @return Number of delivered events
+ */
+size_t znet_ctx_dispatch_drain( znet_ctx_t* ctx, size_t max );
+
+/**
+ * @brief Get dispatcher counters
+ *
+ * @param ctx Context
+ * @param stats Counters
+ */
+void znet_ctx_dispatch_stats( znet_ctx_t* ctx, znet_dispatch_stats_t* stats );
+
+/**
+ * @brief Write modes of uart
+ */
+#define ZNET_UART_MODE_BLOCKING 0    /**< uart_write blocks (default) */
+#define ZNET_UART_MODE_NONBLOCKING 1 /**< Write what fits, queue the rest */
+
+/**
+ * @brief Uart transmit counters
+ */
+typedef struct znet_uart_stats_t
+{
+    uint32_t pending;    /**< Bytes waiting in the outbound ring */
+    uint32_t written;    /**< Bytes accepted by uart_write */
+    uint32_t deferred;   /**< Bytes went through the outbound ring */
+    uint32_t overflow;   /**< Writes failed due to full outbound ring */
+    uint32_t high_water; /**< Max bytes in the outbound ring */
+} znet_uart_stats_t;
+
+/**
+ * @brief Select write mode of uart
+ *
+ * In non-blocking mode the free space of uart tx buffer is queried before
+ * every write and only data that fits is written. The rest is kept in the
+ * outbound ring and written by znet_proc or znet_ctx_uart_writable. A frame
+ * that would not fit into the free space of the ring is rejected whole (see
+ * znet_uart_stats_t::overflow). Blocking mode can be selected when the ring
+ * is empty only.
+ *
+ * @param ctx Context
+ * @param mode ZNET_UART_MODE_*
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_uart_mode( znet_ctx_t* ctx, int mode );
+
+/**
+ * @brief Notify that uart tx buffer has free space
+ *
+ * Call from the event loop on writability of uart, from the thread of
+ * znet_proc.
+ *
+ * @param ctx Context
+ */
+void znet_ctx_uart_writable( znet_ctx_t* ctx );
+
+/**
+ * @brief Get uart transmit counters
+ *
+ * @param ctx Context
+ * @param stats Counters
+ */
+void znet_ctx_uart_stats( znet_ctx_t* ctx, znet_uart_stats_t* stats );
+
+/**
+ * @brief Store write counters
+ */
+typedef struct znet_store_stats_t
+{
+    uint8_t dirty;    /**< flag: changes wait for flush */
+    uint32_t writes;  /**< Calls of store_save */
+    uint32_t bytes;   /**< Bytes written */
+    uint32_t flushes; /**< Flushes done */
+    uint32_t errors;  /**< Failed writes */
+    uint32_t pending; /**< Bytes staged or being written (async) */
+} znet_store_stats_t;
+
+#define ZNET_STORE_MODE_SYNC 0  /**< store_save inside znet_proc (default) */
+#define ZNET_STORE_MODE_ASYNC 1 /**< Hand over batches to store_executor */
+
+/**
+ * @brief Select write mode of store
+ *
+ * In async mode a flush copies the dirty records into a staging buffer, which
+ * is handed over to store_executor. While it is written, the next flush fills
+ * the other buffer. Batches are written strictly one after another in order,
+ * and the records publishing others (headers) are staged after them, so the
+ * store is consistent after every completed write. A failed batch is written
+ * again after the debounce time, later batches wait for it. znet_ctx_free
+ * waits for the batch being written (see store_wait) and retries it once if
+ * it failed; if it fails again, the later writes are dropped. The mode can be
+ * changed when nothing is staged only.
+ *
+ * @param ctx Context
+ * @param mode ZNET_STORE_MODE_*
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_store_mode( znet_ctx_t* ctx, int mode );
+
+/**
+ * @brief Write batch of store writes, called by store_executor
+ *
+ * Calls store_save for the writes in order and stops at the first failure.
+ * The result is picked up by znet_proc.
+ *
+ * @param batch Batch of writes
+ */
+void znet_store_batch_run( znet_store_batch_t* batch );
+
+/**
+ * @brief Configure delayed writes to the store
+ *
+ * Changed records (e.g. parameters metadata) are marked dirty and written by
+ * znet_proc once no change came for debounce_ms, or at the latest
+ * delay_max_ms after the first change. Only dirty records are written,
+ * adjacent ones with one store_save. znet_ctx_free flushes too.
+ *
+ * @param ctx Context
+ * @param debounce_ms Quiet time (ms, default 2000), 0 - write at next znet_proc
+ * @param delay_max_ms Max delay (ms, default 10000)
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_store_debounce( znet_ctx_t* ctx, uint32_t debounce_ms,
+                             uint32_t delay_max_ms );
+
+/**
+ * @brief Write dirty records now, e.g. before power off
+ *
+ * In async mode the records are staged and handed over to store_executor,
+ * see znet_store_stats_t::pending. When the staging buffer has no room, it
+ * waits for the batch being written (see store_wait) and stages the rest,
+ * until all records are handed over. A failed batch is written again first.
+ *
+ * @param ctx Context
+ * @return Return zero on success. On error (a write failed, the records stay
+ * dirty), -1 is returned
+ */
+int znet_ctx_store_flush( znet_ctx_t* ctx );
+
+/**
+ * @brief Get store write counters
+ *
+ * @param ctx Context
+ * @param stats Counters
+ */
+void znet_ctx_store_stats( znet_ctx_t* ctx, znet_store_stats_t* stats );
+
+/**
+ * @brief Report delivered to subscription
+ */
+typedef struct znet_report_t
+{
+    int err;                            /**< Zero on success */
+    znet_node_id_t node_id;             /**< Node ID, INVALID on some errors */
+    znet_node_channel_id_t channel_id;  /**< Channel ID */
+    znet_command_class_t command_class; /**< Command class */
+    uint8_t command;     /**< Report command, Set command for error of a Set,
+                            0 - result of library procedure */
+    const void* value;   /**< Report as for the callback of znet_callbacks_t */
+    size_t size;         /**< Size of value */
+} znet_report_t;
+
+/**
+ * @brief Function prototype for handler of subscription
+ *
+ * @param report Report, valid during the call only
+ * @param arg Parameter of subscription
+ */
+typedef void ( *ZNET_REPORT_HANDLER )( const znet_report_t* report, void* arg );
+
+#define ZNET_REPORT_ANY_CHANNEL 0xFF /**< Filter: any channel */
+
+/**
+ * @brief Filter of subscription
+ *
+ * Zero fields match anything, except the channel (use ZNET_REPORT_ANY_CHANNEL).
+ */
+typedef struct znet_report_filter_t
+{
+    uint8_t nodes[( ZNET_NODE_ID_MAX + 8 ) / 8]; /**< Node set, empty - any */
+    znet_node_channel_id_t channel_id;           /**< Channel ID */
+    znet_command_class_t command_class;          /**< Command class, 0 - any */
+    uint8_t command;                             /**< Report command, 0 - any */
+} znet_report_filter_t;
+
+#define ZNET_REPORT_FILTER_ADD_NODE( filter, node_id ) \
+    ( ( filter )->nodes[( node_id ) / 8] |= (uint8_t)( 1u << ( ( node_id ) % 8 ) ) )
+#define ZNET_REPORT_FILTER_HAS_NODE( filter, node_id ) \
+    ( ( ( filter )->nodes[( node_id ) / 8] >> ( ( node_id ) % 8 ) ) & 1u )
+
+/**
+ * @brief Subscribe to reports matching the filter
+ *
+ * Reports are delivered to matching subscriptions, then to the callback of
+ * znet_callbacks_t, in the dispatch mode of the context. Every report visits
+ * the subscriptions of its command class and command only. Errors without
+ * node ID do not match filters with a node set.
+ *
+ * Subscribe and unsubscribe from the thread that delivers reports. A handler
+ * may unsubscribe itself.
+ *
+ * @param ctx Context
+ * @param filter Filter, copied
+ * @param handler Handler
+ * @param arg Parameter of handler
+ * @return Handle of subscription. On error, -1 is returned
+ */
+int znet_ctx_subscribe( znet_ctx_t* ctx, const znet_report_filter_t* filter,
+                        ZNET_REPORT_HANDLER handler, void* arg );
+
+/**
+ * @brief Cancel subscription
+ *
+ * @param ctx Context
+ * @param handle Handle of subscription
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_unsubscribe( znet_ctx_t* ctx, int handle );
+
 /**
  * @brief Set default
  *
@@ -998,6 +1746,7 @@ void znet_node_rem_break( void );
  */
 void znet_node_list( void );
 
+#if ZNET_CFG_CC_VERSION
 /**
  * @brief Get version info
  *
@@ -1013,14 +1762,18 @@ void znet_node_cmd_version_get( znet_node_id_t node_id );
  */
 void znet_node_cmd_command_version_get( znet_node_id_t node_id,
                                         znet_command_class_t command );
+#endif  // ZNET_CFG_CC_VERSION
 
+#if ZNET_CFG_CC_MANUFACTURER_SPECIFIC
 /**
  * @brief Get manufacturer specific information.
  *
  * @param node_id Node ID
  */
 void znet_node_cmd_manufacturer_specific_get( znet_node_id_t node_id );
+#endif  // ZNET_CFG_CC_MANUFACTURER_SPECIFIC
 
+#if ZNET_CFG_CC_DEVICE_SPECIFIC
 /**
  * @brief Get device specific information.
  *
@@ -1029,14 +1782,18 @@ void znet_node_cmd_manufacturer_specific_get( znet_node_id_t node_id );
  */
 void znet_node_cmd_device_specific_get( znet_node_id_t node_id,
                                         znet_cmd_device_specific_type_t type );
+#endif  // ZNET_CFG_CC_DEVICE_SPECIFIC
 
+#if ZNET_CFG_CC_ZWAVEPLUS_INFO
 /**
  * @brief Get Z-Wave Plus Info.
  *
  * @param node_id Node ID
  */
 void znet_node_cmd_zwaveplus_info_get( znet_node_id_t node_id );
+#endif  // ZNET_CFG_CC_ZWAVEPLUS_INFO
 
+#if ZNET_CFG_CC_BASIC
 /**
  * @brief Operate primary functionality of node
  *
@@ -1058,7 +1815,9 @@ void znet_node_cmd_basic_set(
 void znet_node_cmd_basic_get(
     znet_node_id_t node_id,
     znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */ );
+#endif  // ZNET_CFG_CC_BASIC
 
+#if ZNET_CFG_CC_BINARY_SWITCH
 /**
  * @brief Operate binary switch functionality of node
  *
@@ -1080,10 +1839,16 @@ void znet_node_cmd_binary_switch_set(
 void znet_node_cmd_binary_switch_get(
     znet_node_id_t node_id,
     znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */ );
+#endif  // ZNET_CFG_CC_BINARY_SWITCH
 
+#if ZNET_CFG_CC_CONFIGURATION
 /**
  * @brief Query the value of a configuration parameter
  *
+ * If an identical request is outstanding it is not transmitted again, the
+ * report is delivered once per caller. With 16 different requests
+ * outstanding a new one is not transmitted, its caller gets an error.
+ *
  * @param node_id Node ID
  * @param config_param_num Parameter Number
  */
@@ -1095,6 +1860,9 @@ void znet_node_cmd_configuration_get(
 /**
  * @brief Set the value of a configuration parameter
  *
+ * If the Set is rejected (failed node, full queue of held commands) -1 comes
+ * to node_cmd_configuration_result.
+ *
  * @param node_id Node ID
  * @param config_param_num Parameter Number
  * @param config_size Size of the actual parameter
@@ -1110,6 +1878,9 @@ void znet_node_cmd_configuration_set(
 /**
  * @brief Set the value of one or more configuration parameters.
  *
+ * If the Set is rejected (failed node, full queue of held commands, too big to
+ * be held for a sleeping node) -1 comes to node_cmd_configuration_bulk_result.
+ *
  * @param node_id Node ID
  * @param config_id Parameter Offset
  * @param config_count Number  of the configuration parameters
@@ -1171,15 +1942,507 @@ void znet_node_cmd_configuration_properties_get(
     znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */,
     znet_cmd_configuration_id_t param_number);
 
+/**
+ * @brief Discover all configuration parameters of node
+ *
+ * Follows the Next Parameter Number chain of Properties Reports starting with
+ * parameter 0 and requests Name and Info of every parameter while the chain is
+ * walked. Parameters known for the device model are not requested again. The
+ * result comes to node_cmd_configuration_walk_result.
+ *
+ * @param node_id Node ID
+ * @param channel_id Channel ID
+ */
+void znet_node_cmd_configuration_walk(
+    znet_node_id_t node_id,
+    znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */);
+
+/**
+ * @brief Read all configuration parameters of node into a backup
+ *
+ * Parameters and their sizes come from the metadata of the device model, so
+ * the parameters must be discovered first (znet_node_cmd_configuration_walk).
+ * Every run of parameters with consecutive numbers and the same size is read
+ * by one Bulk Get, the node splits the answer into reports as it needs. A
+ * node that answers no Bulk Get (Configuration Command Class v1) is read
+ * parameter by parameter. A sleeping node is read on its wake up, the backup
+ * fails if it does not wake up within an hour. The result comes to
+ * node_cmd_configuration_backup_result.
+ *
+ * @param node_id Node ID
+ * @param channel_id Channel ID, only ROOT has metadata
+ */
+void znet_node_cmd_configuration_backup(
+    znet_node_id_t node_id,
+    znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */);
+
+/**
+ * @brief Write configuration backup to node, only the differing parameters
+ *
+ * The parameters of the backup are read from the node first (as by
+ * znet_node_cmd_configuration_backup). Parameters with different values are
+ * written by Bulk Sets of adjacent parameters, a few equal values between
+ * them are written again rather than starting a new Set. The result comes to
+ * node_cmd_configuration_restore_result once the Sets are handed over (sent,
+ * or held for a sleeping node), not when the node has applied them. A
+ * rejected Set stops the restore with -1, the result tells the parameters and
+ * frames handed over before it.
+ *
+ * @param node_id Node ID
+ * @param channel_id Channel ID
+ * @param data Backup, see znet_configuration_backup_report_t, it is copied
+ * @param size Size of backup
+ */
+void znet_node_cmd_configuration_restore(
+    znet_node_id_t node_id,
+    znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */,
+    const uint8_t* data, size_t size);
+
 /**
  * @brief Reset all configuration parameters to their default value
  *
+ * If the command is rejected -1 comes to node_cmd_configuration_result.
+ *
  * @param node_id Node ID
  */
 void znet_node_cmd_configuration_default_reset(
     znet_node_id_t node_id,
     znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */);
 
+/// INFO: configuration with explicit context, see functions without ctx
+
+void znet_ctx_node_cmd_configuration_get( znet_ctx_t* ctx,
+                                          znet_node_id_t node_id,
+                                          znet_node_channel_id_t channel_id,
+                                          uint8_t config_param_num );
+
+void znet_ctx_node_cmd_configuration_set(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    uint8_t config_param_num, uint8_t config_size, int set_to_default,
+    znet_cmd_configuration_value_t config_value );
+
+void znet_ctx_node_cmd_configuration_bulk_set(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t config_id, uint8_t config_count,
+    uint8_t config_size, int need_report, int set_to_default,
+    const uint8_t* config_value );
+
+void znet_ctx_node_cmd_configuration_bulk_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t config_id, uint8_t config_count );
+
+void znet_ctx_node_cmd_configuration_name_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number );
+
+void znet_ctx_node_cmd_configuration_info_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number );
+
+void znet_ctx_node_cmd_configuration_properties_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number );
+
+void znet_ctx_node_cmd_configuration_default_reset(
+    znet_ctx_t* ctx, znet_node_id_t node_id,
+    znet_node_channel_id_t channel_id );
+
+void znet_ctx_node_cmd_configuration_walk( znet_ctx_t* ctx,
+                                           znet_node_id_t node_id,
+                                           znet_node_channel_id_t channel_id );
+
+void znet_ctx_node_cmd_configuration_backup( znet_ctx_t* ctx,
+                                             znet_node_id_t node_id,
+                                             znet_node_channel_id_t channel_id );
+
+void znet_ctx_node_cmd_configuration_restore(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    const uint8_t* data, size_t size );
+#endif  // ZNET_CFG_CC_CONFIGURATION
+
+/**
+ * @brief Mark node as sleeping (battery node) or listening
+ *
+ * Commands for a sleeping node are held until its Wake Up Notification, then
+ * sent back-to-back followed by Wake Up No More Information. A Set replaces
+ * the held Set of the same parameter, Default Reset drops the held Sets.
+ * Nodes that send Wake Up Notification are marked as sleeping automatically.
+ * Held commands are sent at once when the node is marked as listening.
+ * Without Wake Up command class (ZNET_CFG_CC_WAKE_UP 0) nothing would send
+ * them, a node can not be marked as sleeping.
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param sleeping Flag: node sleeps
+ * @return Return zero on success. On error or sleeping without Wake Up, -1
+ * is returned
+ */
+int znet_ctx_node_sleeping( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            int sleeping );
+
+/**
+ * @brief Set min interval between Sets to the same target
+ *
+ * A target is node, channel, command class and parameter (configuration).
+ * A Set within the interval after the previous Set to its target is held and
+ * sent when the interval elapses. Later Sets to the target replace the value
+ * of the held one, so a slider sends the latest level only. Sets waiting for
+ * wake up or airtime are coalesced the same way without the interval.
+ *
+ * Applies to Configuration Set and Configuration Bulk Set.
+ *
+ * @param ctx Context
+ * @param interval_ms Min interval (ms), 0 - off (default)
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_set_interval( znet_ctx_t* ctx, uint32_t interval_ms );
+
+/**
+ * @brief Get number of commands held for node
+ *
+ * Counts commands waiting for wake up of node, for min interval of Set (see
+ * znet_ctx_set_interval) and for airtime.
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @return Number of held commands
+ */
+size_t znet_ctx_node_deferred_count( znet_ctx_t* ctx, znet_node_id_t node_id );
+
+/**
+ * @brief Last known value of node
+ */
+typedef struct znet_state_t
+{
+    znet_node_id_t node_id;            /**< Node ID */
+    znet_node_channel_id_t channel_id; /**< Channel ID */
+    znet_command_class_t command;      /**< Command class */
+    uint16_t index;   /**< Parameter Number (configuration) */
+    int32_t value;    /**< Value */
+    uint16_t meta;    /**< Size of value (configuration) */
+    uint32_t version; /**< Number of updates, changes on every report */
+    uint64_t time;    /**< Time of last report (ms, see clock) */
+} znet_state_t;
+
+/**
+ * @brief Read last known value of node
+ *
+ * The library keeps the value of every Configuration Report and Bulk Report,
+ * sign extended by the format of the parameter (signed if it is not known).
+ * Other command classes are not tracked. Up to ZNET_CFG_STATE_MAX values are
+ * kept; when the table is full, a new value replaces the one updated longest
+ * ago. Safe to call from any thread without locks: the snapshot is
+ * consistent, the call retries while the value is being updated by znet_proc.
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param channel_id Channel ID
+ * @param command Command class
+ * @param index Parameter Number (configuration)
+ * @param state Value
+ * @return Return zero on success. On error or not reported yet, -1 is
+ * returned
+ */
+int znet_ctx_state_read( znet_ctx_t* ctx, znet_node_id_t node_id,
+                         znet_node_channel_id_t channel_id,
+                         znet_command_class_t command, uint16_t index,
+                         znet_state_t* state );
+
+/**
+ * @brief Read all last known values of node, see znet_ctx_state_read
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param states Values
+ * @param max Max number of values
+ * @return Number of values
+ */
+size_t znet_ctx_state_node( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_state_t* states, size_t max );
+
+/**
+ * @brief Forget all last known values of node, e.g. after it was removed
+ *
+ * Call from the thread of znet_proc. Readers get -1 for the values afterwards.
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @return Number of values removed
+ */
+size_t znet_ctx_state_clear( znet_ctx_t* ctx, znet_node_id_t node_id );
+
+/**
+ * @brief Round-trip statistics of node
+ */
+typedef struct znet_node_rtt_t
+{
+    uint32_t srtt;    /**< Smoothed round-trip time (ms), 0 - no samples */
+    uint32_t rttvar;  /**< Round-trip time variation (ms) */
+    uint32_t timeout; /**< Current timeout of GET with backoff (ms) */
+    uint8_t backoff;  /**< Lost reports in a row */
+    uint32_t samples; /**< Number of samples */
+} znet_node_rtt_t;
+
+/**
+ * @brief Get round-trip statistics of node
+ *
+ * The time from transmit of GET to its report is sampled. The timeout of GET
+ * is srtt + 4 * rttvar like TCP RTO, it is doubled on every lost report.
+ * A GET without report within the timeout fails through its result callback,
+ * its report arriving later is not delivered.
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param stats Statistics
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_node_rtt( znet_ctx_t* ctx, znet_node_id_t node_id,
+                       znet_node_rtt_t* stats );
+
+/**
+ * @brief Airtime counters
+ */
+typedef struct znet_airtime_stats_t
+{
+    uint32_t used_ms;   /**< Estimated airtime used in the last second */
+    uint32_t budget_ms; /**< Current budget per second, reduced by failures */
+    uint32_t frames;    /**< Frames sent */
+    uint32_t throttled; /**< Frames delayed due to budget */
+    uint32_t failures;  /**< Transmit failures and lost reports */
+} znet_airtime_stats_t;
+
+/**
+ * @brief Configure airtime budget of transmits
+ *
+ * Airtime of every frame is estimated from its size, the data rate and the
+ * hops to node (estimated from its round-trip time). Frames over the budget
+ * of the last second wait in the queue of held commands and are sent by
+ * znet_proc in order. Every failure halves the budget, every received report
+ * grows it back a little.
+ *
+ * @param ctx Context
+ * @param budget_ms Airtime allowed per second (ms), 0 - unlimited
+ * (default 300)
+ * @param rate_kbps Data rate: 9 (9.6 kbit/s), 40 (default) or 100
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_airtime_budget( znet_ctx_t* ctx, uint32_t budget_ms,
+                             uint32_t rate_kbps );
+
+/**
+ * @brief Get airtime counters
+ *
+ * @param ctx Context
+ * @param stats Counters
+ */
+void znet_ctx_airtime_stats( znet_ctx_t* ctx, znet_airtime_stats_t* stats );
+
+/**
+ * @brief Configure detection of failed nodes
+ *
+ * A node is failed after fail_threshold lost reports in a row. Commands to a
+ * failed node are rejected at once: GETs fail through their result callback,
+ * Sets are dropped, held commands waiting for airtime are rejected when their
+ * turn comes. Once per probe interval one GET is let through as a probe, and
+ * only while no commands wait for airtime. If the application sends no GET
+ * when the probe is due, the library sends a Version Get. The interval is
+ * doubled after every lost probe up to probe_max_ms. Any report of the node, its Wake Up
+ * Notification or znet_ctx_node_health_reset recovers it. Sleeping nodes are
+ * never rejected, their commands are held as usual.
+ *
+ * @param ctx Context
+ * @param fail_threshold Lost reports in a row, 0 - off (default 3)
+ * @param probe_ms First probe interval (ms, default 60000)
+ * @param probe_max_ms Max probe interval (ms, default 900000)
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_health_config( znet_ctx_t* ctx, uint8_t fail_threshold,
+                            uint32_t probe_ms, uint32_t probe_max_ms );
+
+/**
+ * @brief Get health of node
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param health Health
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_node_health( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          znet_node_health_t* health );
+
+/**
+ * @brief Mark node as healthy, e.g. after it was repaired
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_node_health_reset( znet_ctx_t* ctx, znet_node_id_t node_id );
+
+/**
+ * @brief Interview every added node in the background
+ *
+ * When znet_node_add completes, the node is queued for interview before
+ * node_add_result is called. Nodes are interviewed one at a time, one GET at a
+ * time, and a GET is sent only while no other command waits for airtime, so
+ * the interview never delays normal traffic. Steps of command classes missing
+ * in the node info are skipped. A step fails if its report is not received
+ * within the timeout of node, a failed node ends its interview. A sleeping
+ * node does not hold up the queue: its step waits for the wake up aside and
+ * the next node is interviewed meanwhile. Progress is reported through
+ * node_interview_result.
+ *
+ * @param ctx Context
+ * @param steps Steps ZNET_INTERVIEW_*, 0 - off (default)
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_interview_auto( znet_ctx_t* ctx, uint8_t steps );
+
+/**
+ * @brief Queue node for background interview, see znet_ctx_interview_auto
+ *
+ * @param ctx Context
+ * @param node_info Node info, only read during the call
+ * @param steps Steps ZNET_INTERVIEW_*
+ * @return Return zero on success. On error (queue full, node queued already),
+ * -1 is returned
+ */
+int znet_ctx_node_interview( znet_ctx_t* ctx, const znet_nodeinfo_t* node_info,
+                             uint8_t steps );
+
+/**
+ * @brief Drop node from the interview queue, the step in progress finishes
+ * without notify
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_node_interview_cancel( znet_ctx_t* ctx, znet_node_id_t node_id );
+
+/**
+ * @brief Number of rollup resolutions of meter series
+ */
+#define ZNET_METER_ROLLUP_LEVELS 2
+
+/**
+ * @brief Raw sample of meter series
+ */
+typedef struct znet_meter_sample_t
+{
+    uint64_t time;  /**< Time of report (ms, see clock) */
+    uint32_t value; /**< Value */
+} znet_meter_sample_t;
+
+/**
+ * @brief Downsampled bucket of meter series
+ */
+typedef struct znet_meter_rollup_t
+{
+    uint64_t time;  /**< Start of bucket (ms, see clock) */
+    uint32_t min;   /**< Min value */
+    uint32_t max;   /**< Max value */
+    uint32_t avg;   /**< Average value */
+    uint32_t count; /**< Number of reports */
+} znet_meter_rollup_t;
+
+/**
+ * @brief Sizes of meter series
+ */
+typedef struct znet_meter_series_config_t
+{
+    size_t raw_bytes; /**< Ring of raw samples per series (bytes), 0 - off */
+    uint32_t resolution_s[ZNET_METER_ROLLUP_LEVELS]; /**< Bucket (s), e.g. 60 */
+    uint16_t rollup_capacity[ZNET_METER_ROLLUP_LEVELS]; /**< Buckets, 0 - off */
+} znet_meter_series_config_t;
+
+#if ZNET_CFG_CC_METER
+/**
+ * @brief Configure history of meter values
+ *
+ * Every Meter Report is added to the series of its node, channel, type and
+ * scale. Raw samples are kept delta encoded (3-4 bytes per sample typical),
+ * the oldest are dropped when the ring is full. Every sample is also folded
+ * into min/max/avg buckets of each resolution, e.g. per minute and per hour.
+ * Memory of a series is allocated on its first report. Existing series are
+ * dropped.
+ *
+ * @param ctx Context
+ * @param config Sizes
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_meter_series_config( znet_ctx_t* ctx,
+                                  const znet_meter_series_config_t* config );
+
+/**
+ * @brief Get raw samples of meter series
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param channel_id Channel ID
+ * @param type Meter type
+ * @param scale Scale
+ * @param samples The newest samples, oldest first
+ * @param max Max number of samples
+ * @return Number of samples
+ */
+size_t znet_ctx_meter_series_samples( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                      znet_node_channel_id_t channel_id,
+                                      uint8_t type, uint16_t scale,
+                                      znet_meter_sample_t* samples, size_t max );
+
+/**
+ * @brief Get rollups of meter series
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param channel_id Channel ID
+ * @param type Meter type
+ * @param scale Scale
+ * @param level Resolution index
+ * @param rollups The newest buckets, oldest first. The last one may be
+ * in progress
+ * @param max Max number of buckets
+ * @return Number of buckets
+ */
+size_t znet_ctx_meter_series_rollups( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                      znet_node_channel_id_t channel_id,
+                                      uint8_t type, uint16_t scale, size_t level,
+                                      znet_meter_rollup_t* rollups, size_t max );
+#endif  // ZNET_CFG_CC_METER
+
+#if ZNET_CFG_CC_CONFIGURATION
+/**
+ * @brief Bind node to the metadata of its device model
+ *
+ * Called by the library on Manufacturer Specific Report. Nodes of the same
+ * model share parameters metadata: Properties, Name and Info of a parameter
+ * are requested from one node only, for other nodes the reports come from the
+ * metadata database. The database is persisted in the store.
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param value Manufacturer specific report of the node
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_ctx_param_db_bind( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            const znet_manufacturer_specific_report_t* value );
+
+/**
+ * @brief Get configuration parameter metadata of node
+ *
+ * @param ctx Context
+ * @param node_id Node ID
+ * @param param_number Parameter Number
+ * @param meta Metadata
+ * @return Return zero on success. On error or not found, -1 is returned
+ */
+int znet_ctx_param_db_lookup( znet_ctx_t* ctx, znet_node_id_t node_id,
+                              znet_cmd_configuration_id_t param_number,
+                              znet_param_meta_t* meta );
+#endif  // ZNET_CFG_CC_CONFIGURATION
+
+#if ZNET_CFG_CC_MULTILEVEL_SWITCH
 /**
  * @brief Operate multilevel switch functionality of node
  *
@@ -1236,7 +2499,9 @@ void znet_node_cmd_multilevel_switch_start_change(
 void znet_node_cmd_multilevel_switch_stop_change(
     znet_node_id_t node_id,
     znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */ );
+#endif  // ZNET_CFG_CC_MULTILEVEL_SWITCH
 
+#if ZNET_CFG_CC_METER
 /**
  * @brief Request the accumulated consumption in physical units from a metering
  * device.
@@ -1270,7 +2535,9 @@ void znet_node_cmd_meter_supported_get(
 void znet_node_cmd_meter_reset(
     znet_node_id_t node_id,
     znet_node_channel_id_t channel_id /* = ZNET_CHANNEL_ID_ROOT */ );
+#endif  // ZNET_CFG_CC_METER
 
+#if ZNET_CFG_CC_MULTICHANNEL
 /**
  * @brief Query the number of End Points implemented by the node.
  *
@@ -1306,6 +2573,7 @@ void znet_node_cmd_multichannel_endpoint_find( znet_node_id_t node_id,
  */
 void znet_node_cmd_multichannel_aggregated_members_get(
     znet_node_id_t node_id, znet_node_channel_id_t channel_id );
+#endif  // ZNET_CFG_CC_MULTICHANNEL
 
 /// INFO: utils
 
@@ -1357,6 +2625,26 @@ void znet_node_cmd_multichannel_aggregated_members_get(
 int znet_node_info( znet_node_id_t node_id, znet_nodeinfo_t* node_info,
                     size_t* node_info_size );
 
+/**
+ * @brief Get node info of all nodes from cache
+ *
+ * Fills contiguous records in order of Node ID, no size probe and no
+ * allocation is needed.
+ *
+ * Example of use:
+ * @code
+ * znet_nodeinfo_record_t nodes[ZNET_NODE_ID_MAX];
+ * size_t count = znet_node_info_all( nodes, ZNET_NODE_ID_MAX );
+ * for( size_t i = 0; i < count; i++ )
+ *     show( (const znet_nodeinfo_t*)&nodes[i] );
+ * @endcode
+ *
+ * @param records Buffer for node info
+ * @param max Max number of records
+ * @return Number of records
+ */
+size_t znet_node_info_all( znet_nodeinfo_record_t* records, size_t max );
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,301 @@
+/**
+ * @file znet.hpp
+ * @date 18 Oct 2026
+ * @brief C++ wrapper: RAII context and subscriptions, views over reports.
+ *
+ * Header only, C++20. Reports end in flexible arrays, the views bound them by
+ * their count fields and point into the report: nothing is copied. A view is
+ * valid as long as the report, i.e. during the callback only.
+ *
+ * Example of use:
+ * @code
+ * static void on_version( int err, znet_node_id_t node_id,
+ *                         const znet_version_report_t* value, void* arg )
+ * {
+ *     for( const auto& firm : znet::firms( *value ) )
+ *         printf( "%u.%u\n", firm.ver, firm.sub_ver );
+ * }
+ *
+ * znet::Context ctx( callbacks );
+ * if( !ctx )
+ *     exit();
+ * for(;;) {
+ *     ctx.proc();
+ *     usleep(1000);
+ * }
+ * @endcode
+ */
+
+#ifndef ZNET_HPP
+#define ZNET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <znet/znet.h>
+
+namespace znet
+{
+
+/// INFO: views
+
+template <class T>
+using element_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+#define ZNET_HPP_SPAN( array, count ) \
+    std::span<const element_t<decltype( array[0] )>>( array, count )
+
+inline std::span<const znet_command_class_t> commands( const znet_nodeinfo_t& r )
+{
+    return ZNET_HPP_SPAN( r.commands, r.commands_count );
+}
+
+inline std::span<const znet_command_class_t> commands( const znet_nodeinfo_record_t& r )
+{
+    return ZNET_HPP_SPAN( r.commands, r.commands_count );
+}
+
+#if ZNET_CFG_CC_VERSION
+inline auto firms( const znet_version_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.firms, r.firms_count );
+}
+#endif
+
+#if ZNET_CFG_CC_DEVICE_SPECIFIC
+inline std::span<const uint8_t> data( const znet_device_specific_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.data, r.data_count );
+}
+
+/**
+ * @brief Device ID as text, empty if its format is binary
+ */
+inline std::string_view text( const znet_device_specific_report_t& r )
+{
+    if( r.data_format != ZNET_CMD_DEVICE_SPECIFIC_FORMAT_UTF8 )
+        return {};
+    return { reinterpret_cast<const char*>( r.data ), r.data_count };
+}
+#endif
+
+#if ZNET_CFG_CC_METER
+inline std::span<const uint8_t> scales( const znet_meter_supported_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.scales, r.scount );
+}
+#endif
+
+#if ZNET_CFG_CC_MULTICHANNEL
+inline std::span<const znet_command_class_t>
+commands( const znet_multichannel_capability_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.commands, r.commands_count );
+}
+
+inline std::span<const znet_node_channel_id_t>
+channel_ids( const znet_multichannel_endpoint_find_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.channel_ids, r.channel_ids_count );
+}
+
+inline std::span<const znet_node_channel_id_t>
+channel_ids( const znet_multichannel_aggregated_members_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.agregated_channel_ids, r.agregated_channel_ids_count );
+}
+#endif
+
+#if ZNET_CFG_CC_CONFIGURATION
+/**
+ * @brief Raw big-endian values, data_count bytes each
+ */
+inline std::span<const uint8_t> data( const znet_configuration_bulk_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.data, (size_t)r.param_number * r.data_count );
+}
+
+inline std::span<const znet_cmd_configuration_decoded_t>
+values( const znet_configuration_bulk_values_t& r )
+{
+    return ZNET_HPP_SPAN( r.values, r.param_number );
+}
+
+inline std::string_view text( const znet_configuration_name_report_t& r )
+{
+    return reinterpret_cast<const char*>( r.data );
+}
+
+inline std::string_view text( const znet_configuration_info_report_t& r )
+{
+    return reinterpret_cast<const char*>( r.data );
+}
+
+inline std::span<const znet_param_meta_t> params( const znet_configuration_walk_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.params, r.count );
+}
+
+inline std::span<const uint8_t> data( const znet_configuration_backup_report_t& r )
+{
+    return ZNET_HPP_SPAN( r.data, r.size );
+}
+
+inline std::string_view bounded( const char* text, size_t size )
+{
+    const void* end = std::memchr( text, '\0', size );
+    return { text, end ? (size_t)( static_cast<const char*>( end ) - text ) : size };
+}
+
+inline std::string_view name( const znet_param_meta_t& meta )
+{
+    return bounded( meta.name, sizeof( meta.name ) );
+}
+
+inline std::string_view info( const znet_param_meta_t& meta )
+{
+    return bounded( meta.info, sizeof( meta.info ) );
+}
+#endif
+
+#undef ZNET_HPP_SPAN
+
+/// INFO: handles
+
+/**
+ * @brief Library context, released on destruction (move-only)
+ */
+class Context
+{
+public:
+    Context() noexcept = default;
+
+    /**
+     * @brief Create context, see znet_ctx_init
+     *
+     * @param callbacks Callbacks, must outlive the context
+     */
+    explicit Context( const znet_callbacks_t& callbacks ) noexcept
+        : ctx_( znet_ctx_init( &callbacks ) )
+    {
+    }
+
+    /**
+     * @brief Init the library, see znet_init. The default context is released
+     * with the object.
+     */
+    static Context global( const znet_callbacks_t& callbacks ) noexcept
+    {
+        Context ctx;
+        if( !znet_init( &callbacks ) )
+            ctx.ctx_ = znet_ctx_get_default();
+        return ctx;
+    }
+
+    Context( Context&& other ) noexcept : ctx_( std::exchange( other.ctx_, nullptr ) ) {}
+
+    Context& operator=( Context&& other ) noexcept
+    {
+        if( this != &other )
+        {
+            reset();
+            ctx_ = std::exchange( other.ctx_, nullptr );
+        }
+        return *this;
+    }
+
+    Context( const Context& ) = delete;
+    Context& operator=( const Context& ) = delete;
+
+    ~Context() { reset(); }
+
+    void reset() noexcept
+    {
+        if( ctx_ )
+            znet_ctx_free( std::exchange( ctx_, nullptr ) );
+    }
+
+    explicit operator bool() const noexcept { return ctx_ != nullptr; }
+    znet_ctx_t* get() const noexcept { return ctx_; }
+    operator znet_ctx_t*() const noexcept { return ctx_; }
+
+    void proc() const { znet_ctx_proc( ctx_ ); }
+
+private:
+    znet_ctx_t* ctx_ = nullptr;
+};
+
+/**
+ * @brief Subscription, unsubscribed on destruction (move-only)
+ */
+class Subscription
+{
+public:
+    Subscription() noexcept = default;
+
+    /**
+     * @brief Subscribe, see znet_ctx_subscribe
+     */
+    Subscription( znet_ctx_t* ctx, const znet_report_filter_t& filter,
+                  ZNET_REPORT_HANDLER handler, void* arg ) noexcept
+        : ctx_( ctx ), handle_( znet_ctx_subscribe( ctx, &filter, handler, arg ) )
+    {
+    }
+
+    Subscription( Subscription&& other ) noexcept
+        : ctx_( other.ctx_ ), handle_( std::exchange( other.handle_, -1 ) )
+    {
+    }
+
+    Subscription& operator=( Subscription&& other ) noexcept
+    {
+        if( this != &other )
+        {
+            reset();
+            ctx_ = other.ctx_;
+            handle_ = std::exchange( other.handle_, -1 );
+        }
+        return *this;
+    }
+
+    Subscription( const Subscription& ) = delete;
+    Subscription& operator=( const Subscription& ) = delete;
+
+    ~Subscription() { reset(); }
+
+    void reset() noexcept
+    {
+        if( handle_ > 0 )
+            znet_ctx_unsubscribe( ctx_, std::exchange( handle_, -1 ) );
+    }
+
+    explicit operator bool() const noexcept { return handle_ > 0; }
+    int handle() const noexcept { return handle_; }
+
+private:
+    znet_ctx_t* ctx_ = nullptr;
+    int handle_ = -1;
+};
+
+/**
+ * @brief Typed view of the report of subscription
+ *
+ * @return Report or nullptr if there is no report. An error may carry the key
+ * of its request only, see report.err
+ */
+template <class T>
+const T* report_as( const znet_report_t& report ) noexcept
+{
+    return report.value && report.size >= sizeof( T )
+               ? static_cast<const T*>( report.value )
+               : nullptr;
+}
+
+}  // namespace znet
+
+#endif  // ZNET_HPP
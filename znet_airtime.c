@@ -0,0 +1,156 @@
+/**
+ * @file znet_airtime.c
+ * @date 18 Oct 2026
+ * @brief Airtime estimate of frames and rolling budget of transmits.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_airtime.h"
+#include "znet_rtt.h"
+
+/// INFO: drop buckets that left the window
+static void _znet_airtime_roll( znet_ctx_t* ctx )
+{
+    znet_airtime_t* airtime = &ctx->airtime;
+
+    uint64_t bucket = ctx->cb->clock( ctx->cb->arg ) / ZNET_AIRTIME_BUCKET_MS;
+    if( bucket - airtime->bucket >= ZNET_AIRTIME_BUCKETS )
+        memset( airtime->used_us, 0, sizeof( airtime->used_us ) );
+    else
+        for( uint64_t i = airtime->bucket + 1; i <= bucket; i++ )
+            airtime->used_us[i % ZNET_AIRTIME_BUCKETS] = 0;
+    airtime->bucket = bucket;
+}
+
+static uint32_t _znet_airtime_used( const znet_airtime_t* airtime )
+{
+    uint32_t used = 0;
+    for( size_t i = 0; i < ZNET_AIRTIME_BUCKETS; i++ )
+        used += airtime->used_us[i];
+    return used;
+}
+
+static uint32_t _znet_airtime_budget( const znet_airtime_t* airtime )
+{
+    return (uint32_t)( (uint64_t)airtime->budget_ms * 1000 * airtime->scale /
+                       ZNET_AIRTIME_SCALE_MAX );
+}
+
+void znet_airtime_init( znet_ctx_t* ctx )
+{
+    znet_airtime_t* airtime = &ctx->airtime;
+
+    memset( airtime, 0, sizeof( znet_airtime_t ) );
+    airtime->budget_ms = ZNET_AIRTIME_BUDGET_MS;
+    airtime->rate_kbps = ZNET_AIRTIME_RATE_KBPS;
+    airtime->scale = ZNET_AIRTIME_SCALE_MAX;
+}
+
+uint32_t znet_airtime_estimate( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                size_t payload )
+{
+    const znet_airtime_t* airtime = &ctx->airtime;
+
+    uint32_t hops = 1;
+    if( node_id >= ZNET_NODE_ID_MIN && node_id <= ZNET_NODE_ID_MAX )
+        hops += ( ctx->rtt[node_id].srtt8 >> 3 ) / ZNET_AIRTIME_HOP_RTT_MS;
+    if( hops > ZNET_AIRTIME_HOPS_MAX )
+        hops = ZNET_AIRTIME_HOPS_MAX;
+
+    /// INFO: routed frame carries the route, 1 byte per repeater
+    size_t bytes = ZNET_AIRTIME_FRAME_OVERHEAD + payload + ( hops - 1 ) +
+                   ZNET_AIRTIME_ACK_SIZE;
+
+    /// INFO: bits / (kbit/s) = ms, * 1000 = us
+    return (uint32_t)( bytes * 8 * 1000 / airtime->rate_kbps * hops );
+}
+
+int znet_airtime_admit( znet_ctx_t* ctx, znet_node_id_t node_id,
+                        size_t payload )
+{
+    znet_airtime_t* airtime = &ctx->airtime;
+    if( !airtime->budget_ms )
+        return 1;
+
+    _znet_airtime_roll( ctx );
+
+    /// INFO: an idle channel admits any frame, even bigger than the budget
+    uint32_t used = _znet_airtime_used( airtime );
+    return used == 0 ||
+           used + znet_airtime_estimate( ctx, node_id, payload ) <=
+               _znet_airtime_budget( airtime );
+}
+
+void znet_airtime_charge( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          size_t payload )
+{
+    znet_airtime_t* airtime = &ctx->airtime;
+
+    _znet_airtime_roll( ctx );
+    airtime->used_us[airtime->bucket % ZNET_AIRTIME_BUCKETS] +=
+        znet_airtime_estimate( ctx, node_id, payload );
+    airtime->frames++;
+}
+
+void znet_airtime_throttled( znet_ctx_t* ctx )
+{
+    ctx->airtime.throttled++;
+}
+
+/// INFO: AIMD like TCP congestion window
+void znet_airtime_failure( znet_ctx_t* ctx )
+{
+    znet_airtime_t* airtime = &ctx->airtime;
+
+    airtime->failures++;
+    airtime->scale /= 2;
+    if( airtime->scale < ZNET_AIRTIME_SCALE_MIN )
+        airtime->scale = ZNET_AIRTIME_SCALE_MIN;
+}
+
+void znet_airtime_success( znet_ctx_t* ctx )
+{
+    znet_airtime_t* airtime = &ctx->airtime;
+
+    airtime->scale += ZNET_AIRTIME_SCALE_STEP;
+    if( airtime->scale > ZNET_AIRTIME_SCALE_MAX )
+        airtime->scale = ZNET_AIRTIME_SCALE_MAX;
+}
+
+int znet_ctx_airtime_budget( znet_ctx_t* ctx, uint32_t budget_ms,
+                             uint32_t rate_kbps )
+{
+    if( !ctx || budget_ms > ZNET_AIRTIME_BUCKETS * ZNET_AIRTIME_BUCKET_MS )
+        return -1;
+
+    if( rate_kbps != 9 && rate_kbps != 40 && rate_kbps != 100 )
+        return -1;
+
+    ctx->airtime.budget_ms = budget_ms;
+    ctx->airtime.rate_kbps = rate_kbps;
+    return 0;
+}
+
+void znet_ctx_airtime_stats( znet_ctx_t* ctx, znet_airtime_stats_t* stats )
+{
+    if( !ctx || !stats )
+        return;
+
+    znet_airtime_t* airtime = &ctx->airtime;
+    _znet_airtime_roll( ctx );
+
+    stats->used_ms = _znet_airtime_used( airtime ) / 1000;
+    stats->budget_ms = _znet_airtime_budget( airtime ) / 1000;
+    stats->frames = airtime->frames;
+    stats->throttled = airtime->throttled;
+    stats->failures = airtime->failures;
+}
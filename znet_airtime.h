@@ -0,0 +1,119 @@
+/**
+ * @file znet_airtime.h
+ * @date 18 Oct 2026
+ * @brief Airtime estimate of frames and rolling budget of transmits.
+ */
+
+#ifndef ZNET_AIRTIME_H
+#define ZNET_AIRTIME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Rolling window of the budget: buckets of ZNET_AIRTIME_BUCKET_MS
+ */
+#define ZNET_AIRTIME_BUCKETS 10
+#define ZNET_AIRTIME_BUCKET_MS 100
+
+/**
+ * @brief Default airtime allowed per window (ms), 0 - unlimited
+ */
+#define ZNET_AIRTIME_BUDGET_MS 300
+
+/**
+ * @brief Default data rate (kbit/s)
+ */
+#define ZNET_AIRTIME_RATE_KBPS 40
+
+/**
+ * @brief Frame without payload: preamble, MAC header, checksum (bytes)
+ */
+#define ZNET_AIRTIME_FRAME_OVERHEAD 20
+#define ZNET_AIRTIME_ACK_SIZE 20
+
+/**
+ * @brief Round-trip added by one hop, used to estimate hops of node (ms)
+ */
+#define ZNET_AIRTIME_HOP_RTT_MS 60
+#define ZNET_AIRTIME_HOPS_MAX 5
+
+/**
+ * @brief Congestion scale, budget = budget_ms * scale / ZNET_AIRTIME_SCALE_MAX
+ */
+#define ZNET_AIRTIME_SCALE_MAX 256
+#define ZNET_AIRTIME_SCALE_MIN 32
+#define ZNET_AIRTIME_SCALE_STEP 8
+
+/**
+ * @brief Airtime state of the context
+ */
+typedef struct znet_airtime_t
+{
+    uint32_t budget_ms;                     /**< Budget per window, 0 - off */
+    uint32_t rate_kbps;                     /**< Data rate */
+    uint32_t scale;                         /**< Congestion scale */
+    uint64_t bucket;                        /**< Index of current bucket */
+    uint32_t used_us[ZNET_AIRTIME_BUCKETS]; /**< Airtime used per bucket */
+
+    uint32_t frames;    /**< Frames admitted */
+    uint32_t throttled; /**< Frames delayed due to budget */
+    uint32_t failures;  /**< Transmit failures */
+} znet_airtime_t;
+
+/**
+ * @brief Init budget with default values
+ */
+void znet_airtime_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Estimate airtime of frame to node with its ack (us)
+ *
+ * Hops are estimated from the round-trip time of node, every hop sends the
+ * frame and its ack again.
+ *
+ * @param payload Size of command (bytes)
+ */
+uint32_t znet_airtime_estimate( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                size_t payload );
+
+/**
+ * @brief Check that frame fits into the budget now
+ *
+ * @return 1 - frame may be sent, 0 - wait
+ */
+int znet_airtime_admit( znet_ctx_t* ctx, znet_node_id_t node_id,
+                        size_t payload );
+
+/**
+ * @brief Account frame being sent
+ */
+void znet_airtime_charge( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          size_t payload );
+
+/**
+ * @brief Count frame delayed due to budget
+ */
+void znet_airtime_throttled( znet_ctx_t* ctx );
+
+/**
+ * @brief Transmit failed or report is lost: halve the budget
+ */
+void znet_airtime_failure( znet_ctx_t* ctx );
+
+/**
+ * @brief Report is received: grow the budget back step by step
+ */
+void znet_airtime_success( znet_ctx_t* ctx );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_AIRTIME_H
@@ -0,0 +1,145 @@
+/**
+ * @file znet_airtime_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of the airtime estimate and the rolling budget.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_airtime_test.c -o znet_airtime_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_airtime.c"
+
+#define TEST_NODE 5
+#define TEST_PAYLOAD 2
+
+/// INFO: 20 + 2 + 20 bytes at 40 kbit/s, direct
+#define TEST_FRAME_US 8400
+
+static struct
+{
+    uint64_t now;
+} test;
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return test.now;
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_airtime_init( &_test_ctx );
+    test.now = 1000000;
+    return &_test_ctx;
+}
+
+/// INFO: frames go until the window is full
+static size_t _test_fill( znet_ctx_t* ctx )
+{
+    size_t frames = 0;
+    while( znet_airtime_admit( ctx, TEST_NODE, TEST_PAYLOAD ) )
+    {
+        znet_airtime_charge( ctx, TEST_NODE, TEST_PAYLOAD );
+        frames++;
+        assert( frames < 1000 );
+    }
+    return frames;
+}
+
+/// INFO: the estimate grows with the hops guessed from the RTT of node
+static void _test_estimate( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( znet_airtime_estimate( ctx, TEST_NODE, TEST_PAYLOAD ) ==
+            TEST_FRAME_US );
+
+    /// INFO: 2 repeaters: the route adds 2 bytes, every hop sends again
+    ctx->rtt[TEST_NODE].srtt8 = ( 2 * ZNET_AIRTIME_HOP_RTT_MS + 10 ) << 3;
+    assert( znet_airtime_estimate( ctx, TEST_NODE, TEST_PAYLOAD ) ==
+            ( 20 + TEST_PAYLOAD + 2 + 20 ) * 8 * 1000 / 40 * 3 );
+
+    ctx->rtt[TEST_NODE].srtt8 = 10000u << 3;
+    assert( znet_airtime_estimate( ctx, TEST_NODE, TEST_PAYLOAD ) ==
+            ( 20 + TEST_PAYLOAD + ZNET_AIRTIME_HOPS_MAX - 1 + 20 ) * 8 * 1000 /
+                40 * ZNET_AIRTIME_HOPS_MAX );
+}
+
+/// INFO: the budget holds for the window, then the buckets roll out
+static void _test_budget( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    size_t frames = ZNET_AIRTIME_BUDGET_MS * 1000 / TEST_FRAME_US;
+    assert( _test_fill( ctx ) == frames );
+
+    /// INFO: half of the window later the frames are still in it
+    test.now += ZNET_AIRTIME_BUCKETS * ZNET_AIRTIME_BUCKET_MS / 2;
+    assert( !znet_airtime_admit( ctx, TEST_NODE, TEST_PAYLOAD ) );
+    assert( _test_fill( ctx ) == 0 );
+
+    test.now += ZNET_AIRTIME_BUCKETS * ZNET_AIRTIME_BUCKET_MS / 2;
+    assert( _test_fill( ctx ) == frames );
+
+    znet_airtime_stats_t stats;
+    znet_ctx_airtime_stats( ctx, &stats );
+    assert( stats.frames == 2 * frames );
+    assert( stats.used_ms == frames * TEST_FRAME_US / 1000 );
+    assert( stats.budget_ms == ZNET_AIRTIME_BUDGET_MS );
+}
+
+/// INFO: failures halve the budget down to its floor, reports grow it back
+static void _test_congestion( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_airtime_failure( ctx );
+    assert( _test_fill( ctx ) ==
+            ZNET_AIRTIME_BUDGET_MS * 1000 / 2 / TEST_FRAME_US );
+
+    for( int i = 0; i < 10; i++ )
+        znet_airtime_failure( ctx );
+    assert( ctx->airtime.scale == ZNET_AIRTIME_SCALE_MIN );
+
+    for( int i = 0; i < 100; i++ )
+        znet_airtime_success( ctx );
+    assert( ctx->airtime.scale == ZNET_AIRTIME_SCALE_MAX );
+    assert( ctx->airtime.failures == 11 );
+}
+
+/// INFO: an idle channel admits a frame bigger than the budget, no budget
+/// admits everything
+static void _test_limits( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( !znet_ctx_airtime_budget( ctx, 10, 9 ) );
+    assert( znet_airtime_estimate( ctx, TEST_NODE, TEST_PAYLOAD ) > 10000 );
+    assert( _test_fill( ctx ) == 1 );
+
+    assert( znet_ctx_airtime_budget( ctx, 10, 50 ) == -1 );
+    assert( znet_ctx_airtime_budget( ctx, 2000, 40 ) == -1 );
+
+    assert( !znet_ctx_airtime_budget( ctx, 0, 40 ) );
+    for( int i = 0; i < 100; i++ )
+        znet_airtime_charge( ctx, TEST_NODE, TEST_PAYLOAD );
+    assert( znet_airtime_admit( ctx, TEST_NODE, TEST_PAYLOAD ) );
+}
+
+int main( void )
+{
+    _test_estimate();
+    _test_budget();
+    _test_congestion();
+    _test_limits();
+    printf( "znet_airtime_test: OK\n" );
+    return 0;
+}
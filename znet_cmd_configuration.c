@@ -12,20 +12,41 @@
 #include <znet/znet.h>
 
 /// INFO: private
-#include "znet_main.h"
+#include "znet_ctx.h"
 #include "znet_log.h"
 #include "znet_store.h"
+#include "znet_inflight.h"
+#include "znet_dispatch.h"
+#include "znet_param_db.h"
+#include "znet_config_walk.h"
+#include "znet_config_backup.h"
+#include "znet_cmd_configuration.h"
+#include "znet_deferred.h"
+#include "znet_airtime.h"
+#include "znet_health.h"
+#include "znet_state.h"
 
 /// INFO: internal
 #include "heap.h"
 #include <znet_lib.h>
 #include <znet_lib_cc_application.h>
 
+#if ZNET_CFG_CC_CONFIGURATION
+
+static void _znet_configuration_value_put( uint8_t* data, uint8_t size,
+                                           int32_t value )
+{
+    for( uint8_t i = 0; i < size; i++ )
+        data[i] = (uint8_t)( (uint32_t)value >> ( ( size - 1 - i ) * 8 ) );
+}
+
 // node cmd configuration report ///////////////////////////////////////
 /// INFO:  Configuration_Report Command Class v1
 void znet_cc_configuration_report( const ZFunction func, uint8_t node_id,
                                    int cc_data_len, const uint8_t* cc_data )
 {
+    znet_ctx_t* ctx = znet_main_ctx( func );
+
     assert( cc_data );
     assert( cc_data_len >= ZNET_CMD_CONFIGURATION_REPORT_CHECK_LEN );
     assert( cc_data[0] == ZNET_COMMAND_CLASS_CONFIGURATION );
@@ -34,6 +55,7 @@ void znet_cc_configuration_report( const ZFunction func, uint8_t node_id,
 
     if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
         return;
+    znet_health_contact( ctx, node_id );
 
     uint8_t param_size = cc_data[3] & CONFIGURATION_SET_LEVEL_SIZE_MASK;
     if( param_size > ZNET_CMD_CONFIGURATION_PARAM_NUM_MAX || param_size == 0 ||
@@ -57,9 +79,38 @@ void znet_cc_configuration_report( const ZFunction func, uint8_t node_id,
         report.value = ( report.value  << 8 ) | ((uint32_t)cc_data[7]);
     }
 
-    if( znet_cb->node_cmd_configuration_result )
-        znet_cb->node_cmd_configuration_result( 0, node_id, func->_endpoint,
-                                                &report, znet_cb->arg );
+    /// INFO: sign extend by the metadata, signed if it is not known, like
+    /// the Bulk Report
+    uint32_t value_ext = report.value;
+    const znet_param_meta_t* meta = znet_param_db_get( ctx, node_id, report.param_number, 0 );
+    if( report.data_count < 4 &&
+        ( !meta || !( meta->flags & ZNET_PARAM_META_PROPERTIES ) ||
+          meta->data_format == ZNET_CMD_CONFIGURATION_FORMAT_SIGNED ) )
+    {
+        uint32_t sign = 1u << ( report.data_count * 8 - 1 );
+        value_ext = ( value_ext ^ sign ) - sign;
+    }
+
+    znet_state_update( ctx, node_id, func->_endpoint,
+                       ZNET_COMMAND_CLASS_CONFIGURATION, report.param_number,
+                       (int32_t)value_ext, report.data_count );
+
+    /// INFO: deliver the report to every caller of the same GET, a report
+    /// without GET once, a late one not at all: its callers got an error
+    int waiters = znet_inflight_complete(
+        ctx, node_id, func->_endpoint, ZNET_COMMAND_CLASS_CONFIGURATION,
+        report.param_number, 1 );
+    if( waiters == 0 )
+        waiters = 1;
+
+    for( int i = 0; i < waiters; i++ )
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION,
+                       0, node_id, func->_endpoint, &report, sizeof( report ) );
+
+    uint8_t value[4];
+    _znet_configuration_value_put( value, report.data_count, (int32_t)report.value );
+    znet_config_backup_values( ctx, node_id, func->_endpoint, report.param_number,
+                               1, report.data_count, value, 0, 0 );
 }
 
 /// INFO: Configuration_Get Command Class v1
@@ -67,32 +118,79 @@ void znet_cc_configuration_report( const ZFunction func, uint8_t node_id,
 static void _znet_node_cmd_configuration_get_cb( ZFunction func, void* arg,
                                          ZFuncFailures_e reason )
 {
-    if( FUNC_OK != reason )
-    {
-        if( znet_cb->node_cmd_configuration_result )
-            znet_cb->node_cmd_configuration_result(
-                -1, ZNET_NODE_ID_INVALID, func->_endpoint, NULL, znet_cb->arg );
-    }
+    znet_ctx_t* ctx = znet_main_ctx( func );
+    (void)arg;
+
+    /// INFO: every caller of the failed GET gets the error
+    znet_inflight_t entry = { .node_id = ZNET_NODE_ID_INVALID,
+                              .channel_id = func->_endpoint };
+    uint8_t waiters = znet_inflight_transmitted(
+        ctx, ZNET_COMMAND_CLASS_CONFIGURATION, FUNC_OK == reason, &entry );
+    if( FUNC_OK == reason )
+        return;
+
+    znet_airtime_failure( ctx );
+    znet_configuration_get_failed( ctx, entry.node_id, entry.channel_id,
+                                   (uint8_t)entry.param, waiters );
 }
 
-void znet_node_cmd_configuration_get(
-    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
-    uint8_t config_param_num )
+void znet_configuration_get_failed( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                    znet_node_channel_id_t channel_id,
+                                    uint8_t config_param_num, uint8_t waiters )
+{
+    znet_configuration_report_t report = { .param_number = config_param_num };
+    for( uint8_t i = 0; i < waiters; i++ )
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION,
+                       -1, node_id, channel_id, &report, sizeof( report ) );
+}
+
+void znet_configuration_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    uint8_t config_param_num, uint8_t waiters )
 {
     assert( config_param_num );
-    if( !znet_cb )
+    assert( waiters );
+    if( !ctx )
     {
         ZNET_LOGE( "ZNET: Library not initialized!\n" );
         return;
     }
 
     if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
-        if( znet_cb->node_cmd_configuration_result )
-            znet_cb->node_cmd_configuration_result( -1, ZNET_NODE_ID_INVALID,
-                                             channel_id, NULL, znet_cb->arg );
+    {
+        znet_configuration_get_failed( ctx, ZNET_NODE_ID_INVALID, channel_id,
+                                       config_param_num, waiters );
+        return;
+    }
 
      /// TODO: check in storage node_id
-    /// TODO: check wait report for node_id
+
+    /// INFO: sleeping node gets it on its next wake up
+    znet_deferred_cmd_t deferred = {
+        .op = ZNET_DEFERRED_CONFIGURATION_GET, .node_id = node_id,
+        .channel_id = channel_id, .param = config_param_num,
+        .waiters = waiters };
+    int held = znet_deferred_hold( ctx, &deferred );
+    if( held < 0 )
+        znet_configuration_get_failed( ctx, node_id, channel_id,
+                                       config_param_num, waiters );
+    if( held )
+        return;
+
+    /// INFO: identical GET is outstanding, wait for its report; an untracked
+    /// GET would take the transmit result of another one
+    int attached = znet_inflight_attach( ctx, node_id, channel_id,
+                                         ZNET_COMMAND_CLASS_CONFIGURATION,
+                                         config_param_num, waiters );
+    if( attached > 0 )
+        return;
+    if( attached < 0 )
+    {
+        ZNET_LOGE( "ZNET: Too many outstanding GETs!\n" );
+        znet_configuration_get_failed( ctx, node_id, channel_id,
+                                       config_param_num, waiters );
+        return;
+    }
 
     znet_node_channel_id_t from_to[2] = { ZNET_CHANNEL_ID_ROOT, channel_id };
     void* callbackArg = NULL;
@@ -103,33 +201,42 @@ void znet_node_cmd_configuration_get(
         encap |= Encapsulation_MuCh;
     }
 
-    if( !znet_cc_configuration_get( &znet, node_id, config_param_num,
+    if( !znet_cc_configuration_get( &ctx->znet, node_id, config_param_num,
                             _znet_node_cmd_configuration_get_cb, callbackArg, encap ) )
     {
-        if( znet_cb->node_cmd_configuration_result )
-            znet_cb->node_cmd_configuration_result( -1, ZNET_NODE_ID_INVALID,
-                                            channel_id, NULL, znet_cb->arg );
+        znet_inflight_complete( ctx, node_id, channel_id,
+                                ZNET_COMMAND_CLASS_CONFIGURATION,
+                                config_param_num, 0 );
+        znet_configuration_get_failed( ctx, node_id, channel_id,
+                                       config_param_num, waiters );
     }
 }
 
+void znet_ctx_node_cmd_configuration_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    uint8_t config_param_num)
+{
+    znet_configuration_get( ctx, node_id, channel_id, config_param_num, 1 );
+}
+
 /// INFO: Configuration_Set Command Class v1
-void znet_node_cmd_configuration_set(
-    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+int znet_configuration_set(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
     uint8_t config_param_num, uint8_t config_size,
     int set_to_default, znet_cmd_configuration_value_t config_value)
 {
     assert( config_param_num > 0 );
 
-    if( !znet_cb )
+    if( !ctx )
     {
         ZNET_LOGE( "ZNET: Library not initialized!\n" );
-        return;
+        return -1;
     }
 
     if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
     {
         ZNET_LOGE( "ZNET: Invalid node ID!\n" );
-        return;
+        return -1;
     }
 
     uint8_t temp_val = config_size & CONFIGURATION_SET_LEVEL_SIZE_MASK;
@@ -137,9 +244,27 @@ void znet_node_cmd_configuration_set(
         temp_val == ZNET_CMD_CONFIGURATION_PARAM_NUM_INVALID )
     {
         ZNET_LOGE( "ZNET: Invalid size ID!\n" );
-        return;
+        return -1;
     }
 
+    /// INFO: sleeping node gets it on its next wake up
+    znet_deferred_cmd_t deferred = {
+        .op = ZNET_DEFERRED_CONFIGURATION_SET, .node_id = node_id,
+        .channel_id = channel_id, .param = config_param_num,
+        .size = config_size, .value = config_value,
+        .flags = set_to_default ? ZNET_DEFERRED_FLAG_DEFAULT : 0 };
+    /// INFO: results of Sets are no Configuration Reports, an awaiter of the
+    /// report must not take them
+    znet_configuration_report_t result = { .param_number = config_param_num,
+                                           .data_count = temp_val,
+                                           .value = config_value };
+    int held = znet_deferred_hold( ctx, &deferred );
+    if( held < 0 )
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_SET,
+                       -1, node_id, channel_id, &result, sizeof( result ) );
+    if( held )
+        return held < 0 ? -1 : 0;
+
     znet_node_channel_id_t from_to[2] = { ZNET_CHANNEL_ID_ROOT, channel_id };
     void* callbackArg = NULL;
     encap_type_t encap = Encapsulation_None;
@@ -148,21 +273,38 @@ void znet_node_cmd_configuration_set(
         callbackArg = &from_to;
         encap |= Encapsulation_MuCh;
     }
-    znet_cc_configuration_set(&znet, node_id, config_param_num, ( set_to_default ? TRUE : FALSE ),
-        config_value, config_size,  NULL,  callbackArg, encap );
+    if( !znet_cc_configuration_set(&ctx->znet, node_id, config_param_num, ( set_to_default ? TRUE : FALSE ),
+        config_value, config_size,  NULL,  callbackArg, encap ) )
+    {
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_SET,
+                       -1, node_id, channel_id, &result, sizeof( result ) );
+        return -1;
+    }
+    return 0;
+}
+
+void znet_ctx_node_cmd_configuration_set(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    uint8_t config_param_num, uint8_t config_size,
+    int set_to_default, znet_cmd_configuration_value_t config_value)
+{
+    znet_configuration_set( ctx, node_id, channel_id, config_param_num,
+                            config_size, set_to_default, config_value );
 }
 
 /// INFO: Configuration Command Class v2
 void znet_cc_configuration_bulk_report( const ZFunction func, uint8_t node_id,
                                    int cc_data_len, const uint8_t* cc_data )
 {
+    znet_ctx_t* ctx = znet_main_ctx( func );
+
     assert( cc_data );
     assert( cc_data_len >= ZNET_CMD_CONFIGURATION_BULK_REPORT_CHECK_LEN );
     assert( cc_data[0] == ZNET_COMMAND_CLASS_CONFIGURATION );
     assert( cc_data[1] == CONFIGURATION_BULK_REPORT_V4 );
     assert( cc_data[4] );
 
-    //TBD: consider usage of cc_data[5] -> Reports to follow
+    /// INFO: Reports to follow (cc_data[5]) keeps the backup waiting
     uint16_t temp_value = ((uint16_t)cc_data[2] << 8) | cc_data[3];
     if( temp_value == 0 )
     {
@@ -180,11 +322,12 @@ void znet_cc_configuration_bulk_report( const ZFunction func, uint8_t node_id,
 
     if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
         return;
+    znet_health_contact( ctx, node_id );
 
     /* Configuration Value is (M*N bytes) where N = param_size
        and number of parameters M = cc_data[4] */
     size_t data_count = param_size * cc_data[4];
-    assert( cc_data_len >= ZNET_CMD_CONFIGURATION_BULK_REPORT_CHECK_LEN + data_count );
+    assert( (size_t)cc_data_len >= ZNET_CMD_CONFIGURATION_BULK_REPORT_CHECK_LEN + data_count );
 
     const size_t buff_size = sizeof( znet_configuration_bulk_report_t ) + data_count;
     uint8_t buff[buff_size];
@@ -199,28 +342,65 @@ void znet_cc_configuration_bulk_report( const ZFunction func, uint8_t node_id,
     for( size_t i = 0; i < data_count; i++ )
         bulk_report->data[i] = cc_data[ZNET_CMD_CONFIGURATION_BULK_REPORT_CHECK_LEN + i];
 
+    /// INFO: decode all values at once, then sign extend by the metadata
+    const size_t values_size = sizeof( znet_configuration_bulk_values_t ) +
+                               cc_data[4] * sizeof( znet_cmd_configuration_decoded_t );
+    uint32_t values_buff[( values_size + sizeof( uint32_t ) - 1 ) / sizeof( uint32_t )];
+    memset( values_buff, 0, values_size );
+
+    znet_configuration_bulk_values_t* values = (znet_configuration_bulk_values_t*)values_buff;
+    values->param_offset = temp_value;
+    values->param_number = cc_data[4];
+    values->rep_to_follows = cc_data[5];
+    values->data_count = param_size;
+    znet_param_db_values( bulk_report->data, param_size, cc_data[4], &values->values[0].u );
+
+    for( uint8_t i = 0; i < cc_data[4]; i++ )
+    {
+        const znet_param_meta_t* meta = znet_param_db_get( ctx, node_id, temp_value + i, 0 );
+        if( meta && ( meta->flags & ZNET_PARAM_META_PROPERTIES ) &&
+            meta->data_format != ZNET_CMD_CONFIGURATION_FORMAT_SIGNED )
+            continue;
+
+        values->signed_map[i >> 3] |= (uint8_t)( 1u << ( i & 7 ) );
+        if( param_size < 4 )
+        {
+            uint32_t sign = 1u << ( param_size * 8 - 1 );
+            values->values[i].u = ( values->values[i].u ^ sign ) - sign;
+        }
+    }
+
+    for( uint8_t i = 0; i < cc_data[4]; i++ )
+        znet_state_update( ctx, node_id, func->_endpoint,
+                           ZNET_COMMAND_CLASS_CONFIGURATION, temp_value + i,
+                           values->values[i].s, param_size );
+
     /// TODO: check in storage node_id
     /// TODO: check wait report for node_id done!
-    if( znet_cb->node_cmd_configuration_bulk_result )
-        znet_cb->node_cmd_configuration_bulk_result( 0, node_id, func->_endpoint,
-                                                bulk_report, znet_cb->arg );
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BULK,
+                   0, node_id, func->_endpoint, bulk_report, buff_size );
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BULK_VALUES,
+                   0, node_id, func->_endpoint, values, values_size );
+    znet_config_backup_values( ctx, node_id, func->_endpoint, temp_value,
+                               cc_data[4], param_size, bulk_report->data,
+                               cc_data[5], 1 );
 }
 
-void znet_node_cmd_configuration_bulk_set(
-    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+int znet_configuration_bulk_set(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
     znet_cmd_configuration_id_t config_id,
     uint8_t config_count, uint8_t config_size,
     int need_report, int set_to_default, const uint8_t* config_value)
 {
-    if( !znet_cb )
+    if( !ctx )
     {
         ZNET_LOGE( "ZNET: Library not initialized!\n" );
-        return;
+        return -1;
     }
 
     if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
     {
-        return;
+        return -1;
     }
 
     uint8_t temp_val = config_size & CONFIGURATION_SET_LEVEL_SIZE_MASK;
@@ -228,9 +408,29 @@ void znet_node_cmd_configuration_bulk_set(
         temp_val == ZNET_CMD_CONFIGURATION_PARAM_NUM_INVALID )
     {
         ZNET_LOGE( "ZNET: Invalid size ID!\n" );
-        return;
+        return -1;
     }
 
+    /// INFO: sleeping node gets it on its next wake up
+    znet_deferred_cmd_t deferred = {
+        .op = ZNET_DEFERRED_CONFIGURATION_BULK_SET, .node_id = node_id,
+        .channel_id = channel_id, .param = config_id, .size = temp_val,
+        .count = config_count,
+        .flags = ( set_to_default ? ZNET_DEFERRED_FLAG_DEFAULT : 0 ) |
+                 ( need_report ? ZNET_DEFERRED_FLAG_REPORT : 0 ) };
+    size_t data_size = (size_t)config_count * temp_val;
+    memcpy( deferred.data, config_value,
+            data_size < sizeof( deferred.data ) ? data_size : sizeof( deferred.data ) );
+    znet_configuration_bulk_report_t result = { .param_offset = config_id,
+                                                .param_number = config_count,
+                                                .data_count = temp_val };
+    int held = znet_deferred_hold( ctx, &deferred );
+    if( held < 0 )
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BULK_SET,
+                       -1, node_id, channel_id, &result, sizeof( result ) );
+    if( held )
+        return held < 0 ? -1 : 0;
+
     znet_node_channel_id_t from_to[2] = { ZNET_CHANNEL_ID_ROOT, channel_id };
     void* callbackArg = NULL;
     encap_type_t encap = Encapsulation_None;
@@ -240,16 +440,33 @@ void znet_node_cmd_configuration_bulk_set(
         encap |= Encapsulation_MuCh;
     }
 
-    znet_cc_configuration_bulk_set( &znet, node_id, config_id, config_count,
+    if( !znet_cc_configuration_bulk_set( &ctx->znet, node_id, config_id, config_count,
         ( set_to_default ? TRUE : FALSE ), ( need_report ? TRUE : FALSE ),
-        temp_val, config_value, NULL, callbackArg, encap );
+        temp_val, config_value, NULL, callbackArg, encap ) )
+    {
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BULK_SET,
+                       -1, node_id, channel_id, &result, sizeof( result ) );
+        return -1;
+    }
+    return 0;
 }
 
-void znet_node_cmd_configuration_bulk_get(
-    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+void znet_ctx_node_cmd_configuration_bulk_set(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t config_id,
+    uint8_t config_count, uint8_t config_size,
+    int need_report, int set_to_default, const uint8_t* config_value)
+{
+    znet_configuration_bulk_set( ctx, node_id, channel_id, config_id,
+                                 config_count, config_size, need_report,
+                                 set_to_default, config_value );
+}
+
+void znet_ctx_node_cmd_configuration_bulk_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
     znet_cmd_configuration_id_t config_id, uint8_t config_count)
 {
-    if( !znet_cb )
+    if( !ctx )
     {
         ZNET_LOGE( "ZNET: Library not initialized!\n" );
         return;
@@ -260,6 +477,20 @@ void znet_node_cmd_configuration_bulk_get(
         return;
     }
 
+    /// INFO: sleeping node gets it on its next wake up
+    znet_deferred_cmd_t deferred = {
+        .op = ZNET_DEFERRED_CONFIGURATION_BULK_GET, .node_id = node_id,
+        .channel_id = channel_id,
+        .param = config_id, .count = config_count };
+    znet_configuration_bulk_report_t failed = { .param_offset = config_id,
+                                                .param_number = config_count };
+    int held = znet_deferred_hold( ctx, &deferred );
+    if( held < 0 )
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BULK,
+                       -1, node_id, channel_id, &failed, sizeof( failed ) );
+    if( held )
+        return;
+
     znet_node_channel_id_t from_to[2] = { ZNET_CHANNEL_ID_ROOT, channel_id };
     void* callbackArg = NULL;
     encap_type_t encap = Encapsulation_None;
@@ -269,20 +500,131 @@ void znet_node_cmd_configuration_bulk_get(
         encap |= Encapsulation_MuCh;
     }
 
-    if( !znet_cc_configuration_bulk_get( &znet, node_id, config_id,
+    if( !znet_cc_configuration_bulk_get( &ctx->znet, node_id, config_id,
                             config_count, NULL, callbackArg, encap  ) )
     {
-        if( znet_cb->node_cmd_configuration_bulk_result )
-            znet_cb->node_cmd_configuration_bulk_result(
-                                        -1, ZNET_NODE_ID_INVALID,
-                                        channel_id, NULL, znet_cb->arg );
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BULK,
+                       -1, node_id, channel_id, &failed, sizeof( failed ) );
     }
 }
 
 /// INFO: Configuration Command Class v3
+
+/// INFO: Name Report and Info Report have the same layout
+static void _znet_configuration_text_dispatch(
+    znet_ctx_t* ctx, znet_event_type_t type, znet_node_id_t node_id,
+    znet_node_channel_id_t channel_id, znet_cmd_configuration_id_t param_number,
+    uint8_t flag, const char* text )
+{
+    size_t text_count = strlen( text );
+    const size_t buff_size = sizeof( znet_configuration_name_report_t ) + text_count + 1;
+    uint8_t buff[buff_size];
+    memset( buff, 0, buff_size );
+
+    znet_configuration_name_report_t* text_report =
+        (znet_configuration_name_report_t*)&buff;
+    text_report->param_number = param_number;
+    text_report->rep_to_follows = 0;
+    memcpy( text_report->data, text, text_count );
+
+    znet_dispatch( ctx, type, 0, node_id, channel_id, text_report, buff_size );
+    znet_config_walk_text( ctx, node_id, channel_id, param_number, flag,
+                           (const uint8_t*)text, text_count, 0 );
+}
+
+/// INFO: a discovery waiting for the answer goes on without it
+static void _znet_configuration_request_failed(
+    znet_ctx_t* ctx, znet_event_type_t type, znet_node_id_t node_id,
+    znet_node_channel_id_t channel_id, znet_cmd_configuration_id_t param_number,
+    uint8_t flag )
+{
+    /// INFO: the Parameter Number tells the awaiter of the report
+    if( type == ZNET_EVENT_CONFIGURATION_PROPERTIES )
+    {
+        znet_configuration_properties_report_t report = {
+            .param_number = param_number };
+        znet_dispatch( ctx, type, -1, node_id, channel_id, &report,
+                       sizeof( report ) );
+    }
+    else
+    {
+        znet_configuration_name_report_t report = {
+            .param_number = param_number };
+        znet_dispatch( ctx, type, -1, node_id, channel_id, &report,
+                       sizeof( report ) );
+    }
+    znet_config_walk_failed( ctx, node_id, channel_id, param_number, flag );
+}
+
+static void _znet_configuration_properties_dispatch(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    const znet_param_meta_t* meta )
+{
+    /* Data: Properties1, Min Value, Max Value, Default Value (N bytes each),
+       Next Parameter Number (2 bytes) */
+    size_t param_size = meta->data_size * 3;
+    const size_t buff_size = sizeof( znet_configuration_properties_report_t ) + param_size + 3;
+    uint8_t buff[buff_size];
+    memset( buff, 0, buff_size );
+
+    znet_configuration_properties_report_t* prop_report =
+        (znet_configuration_properties_report_t*)&buff;
+    prop_report->param_number = meta->param_number;
+    prop_report->data_format = meta->data_format;
+    prop_report->data_size = meta->data_size;
+    prop_report->next_param = meta->next_param;
+
+    uint8_t* data = prop_report->data;
+    *data++ = ( ( meta->data_format << CONFIGURATION_PROPERTIES_REPORT_PROPERTIES1_FORMAT_SHIFT_V4 ) &
+                CONFIGURATION_PROPERTIES_REPORT_PROPERTIES1_FORMAT_MASK_V4 ) |
+              ( meta->data_size & CONFIGURATION_PROPERTIES_REPORT_PROPERTIES1_SIZE_MASK_V4 );
+    _znet_configuration_value_put( data, meta->data_size, meta->min_value );
+    data += meta->data_size;
+    _znet_configuration_value_put( data, meta->data_size, meta->max_value );
+    data += meta->data_size;
+    _znet_configuration_value_put( data, meta->data_size, meta->default_value );
+    data += meta->data_size;
+    *data++ = meta->next_param >> 8;
+    *data = meta->next_param & 0xFF;
+
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_PROPERTIES,
+                   0, node_id, channel_id, prop_report, buff_size );
+    znet_config_walk_properties( ctx, node_id, channel_id, meta );
+}
+
+static void _znet_configuration_meta_text(
+    znet_ctx_t* ctx, znet_node_id_t node_id,
+    znet_cmd_configuration_id_t param_number, uint8_t flag,
+    const uint8_t* data, size_t size, uint8_t rep_to_follows )
+{
+    znet_param_meta_t* meta = znet_param_db_get( ctx, node_id, param_number, 1 );
+    if( !meta )
+        return;
+
+    uint8_t partial = ( flag == ZNET_PARAM_META_NAME ) ?
+        ZNET_PARAM_META_NAME_PARTIAL : ZNET_PARAM_META_INFO_PARTIAL;
+    if( flag == ZNET_PARAM_META_NAME )
+        znet_param_db_text( meta->name, sizeof( meta->name ), data, size,
+                            !( meta->flags & partial ) );
+    else
+        znet_param_db_text( meta->info, sizeof( meta->info ), data, size,
+                            !( meta->flags & partial ) );
+
+    if( rep_to_follows )
+    {
+        meta->flags |= partial;
+        return;
+    }
+
+    meta->flags = ( meta->flags & ~partial ) | flag;
+    znet_param_db_dirty( ctx, node_id, meta );
+}
+
 void znet_cc_configuration_name_report( const ZFunction func, uint8_t node_id,
                                    int cc_data_len, const uint8_t* cc_data  )
 {
+    znet_ctx_t* ctx = znet_main_ctx( func );
+
     assert( cc_data );
     assert( cc_data_len >= ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN );
     assert( cc_data[0] == ZNET_COMMAND_CLASS_CONFIGURATION );
@@ -290,33 +632,40 @@ void znet_cc_configuration_name_report( const ZFunction func, uint8_t node_id,
 
     if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
         return;
-    //TBD: consider usage of cc_data[4] -> Reports to follow
+    znet_health_contact( ctx, node_id );
 
-    uint16_t name_count = ((uint16_t)cc_data[2] << 8) | cc_data[3];
-    assert( cc_data_len >= ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN + name_count );
+    uint16_t param_num = ((uint16_t)cc_data[2] << 8) | cc_data[3];
+    size_t name_count = cc_data_len - ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN;
 
-    const size_t buff_size = sizeof( znet_configuration_name_report_t ) + name_count;
+    const size_t buff_size = sizeof( znet_configuration_name_report_t ) + name_count + 1;
     uint8_t buff[buff_size];
     memset( buff, 0, buff_size );
 
     znet_configuration_name_report_t* name_report = (znet_configuration_name_report_t*)&buff;
-    name_report->param_number = name_count;
+    name_report->param_number = param_num;
     name_report->rep_to_follows = cc_data[4];
-    for (int i = 0; i < name_count; i++)
+    for (size_t i = 0; i < name_count; i++)
         name_report->data[i] = cc_data[ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN + i];
 
-    /// TODO: check in storage node_id
+    if( func->_endpoint == ZNET_CHANNEL_ID_ROOT )
+        _znet_configuration_meta_text(
+            ctx, node_id, param_num, ZNET_PARAM_META_NAME,
+            &cc_data[ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN], name_count,
+            cc_data[4] );
+
     /// TODO: check wait report for node_id done!
-    if( znet_cb->node_cmd_configuration_name_result )
-        znet_cb->node_cmd_configuration_name_result( 0, node_id, func->_endpoint,
-                                                name_report, znet_cb->arg );
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_NAME,
+                   0, node_id, func->_endpoint, name_report, buff_size );
+    znet_config_walk_text( ctx, node_id, func->_endpoint, param_num, ZNET_PARAM_META_NAME,
+                           &cc_data[ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN],
+                           name_count, cc_data[4] );
 }
 
-void znet_node_cmd_configuration_name_get(
-    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+void znet_ctx_node_cmd_configuration_name_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
     znet_cmd_configuration_id_t param_number)
 {
-    if( !znet_cb )
+    if( !ctx )
     {
         ZNET_LOGE( "ZNET: Library not initialized!\n" );
         return;
@@ -336,19 +685,39 @@ void znet_node_cmd_configuration_name_get(
         encap |= Encapsulation_MuCh;
     }
 
-    if( !znet_cc_configuration_name_get( &znet, node_id, param_number,
+    /// INFO: known from a node of the same model
+    const znet_param_meta_t* meta = znet_param_db_get( ctx, node_id, param_number, 0 );
+    if( channel_id == ZNET_CHANNEL_ID_ROOT && meta && ( meta->flags & ZNET_PARAM_META_NAME ) )
+    {
+        _znet_configuration_text_dispatch( ctx, ZNET_EVENT_CONFIGURATION_NAME, node_id, channel_id,
+                                           param_number, ZNET_PARAM_META_NAME, meta->name );
+        return;
+    }
+
+    /// INFO: sleeping node gets it on its next wake up
+    znet_deferred_cmd_t deferred = {
+        .op = ZNET_DEFERRED_CONFIGURATION_NAME_GET, .node_id = node_id,
+        .channel_id = channel_id, .param = param_number };
+    int held = znet_deferred_hold( ctx, &deferred );
+    if( held < 0 )
+        _znet_configuration_request_failed( ctx, ZNET_EVENT_CONFIGURATION_NAME, node_id,
+                                            channel_id, param_number, ZNET_PARAM_META_NAME );
+    if( held )
+        return;
+
+    if( !znet_cc_configuration_name_get( &ctx->znet, node_id, param_number,
                                             NULL, callbackArg, encap  ) )
     {
-        if( znet_cb->node_cmd_configuration_name_result )
-            znet_cb->node_cmd_configuration_name_result(
-                                        -1, ZNET_NODE_ID_INVALID,
-                                        channel_id, NULL, znet_cb->arg );
+        _znet_configuration_request_failed( ctx, ZNET_EVENT_CONFIGURATION_NAME, node_id,
+                                            channel_id, param_number, ZNET_PARAM_META_NAME );
     }
 }
 
 void znet_cc_configuration_info_report( const ZFunction func, uint8_t node_id,
                                    int cc_data_len, const uint8_t* cc_data  )
 {
+    znet_ctx_t* ctx = znet_main_ctx( func );
+
     assert( cc_data );
     assert( cc_data_len >= ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN );
     assert( cc_data[0] == ZNET_COMMAND_CLASS_CONFIGURATION );
@@ -356,34 +725,41 @@ void znet_cc_configuration_info_report( const ZFunction func, uint8_t node_id,
 
     if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
         return;
-    //TBD: consider usage of cc_data[4] -> Reports to follow
+    znet_health_contact( ctx, node_id );
 
-    uint16_t info_count = ((uint16_t)(cc_data[2] << 8)) | cc_data[3];
-    assert( cc_data_len >= ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN + info_count );
+    uint16_t param_num = ((uint16_t)(cc_data[2] << 8)) | cc_data[3];
+    size_t info_count = cc_data_len - ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN;
 
-    const size_t buff_size = sizeof( znet_configuration_info_report_t ) + info_count;
+    const size_t buff_size = sizeof( znet_configuration_info_report_t ) + info_count + 1;
     uint8_t buff[buff_size];
     memset( buff, 0, buff_size );
 
     znet_configuration_info_report_t* info_report =
         (znet_configuration_info_report_t*)&buff;
-    info_report->param_number = info_count;
+    info_report->param_number = param_num;
     info_report->rep_to_follows = cc_data[4];
-    for (int i = 0; i < info_count; i++)
+    for (size_t i = 0; i < info_count; i++)
         info_report->data[i] = cc_data[ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN + i];
 
-    /// TODO: check in storage node_id
+    if( func->_endpoint == ZNET_CHANNEL_ID_ROOT )
+        _znet_configuration_meta_text(
+            ctx, node_id, param_num, ZNET_PARAM_META_INFO,
+            &cc_data[ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN], info_count,
+            cc_data[4] );
+
     /// TODO: check wait report for node_id done!
-    if( znet_cb->node_cmd_configuration_info_result )
-        znet_cb->node_cmd_configuration_info_result( 0, node_id, func->_endpoint,
-                                                info_report, znet_cb->arg );
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_INFO,
+                   0, node_id, func->_endpoint, info_report, buff_size );
+    znet_config_walk_text( ctx, node_id, func->_endpoint, param_num, ZNET_PARAM_META_INFO,
+                           &cc_data[ZNET_CMD_CONFIGURATION_NIP_REPORT_CHECK_LEN],
+                           info_count, cc_data[4] );
 }
 
-void znet_node_cmd_configuration_info_get(
-    znet_node_id_t node_id,  znet_node_channel_id_t channel_id,
+void znet_ctx_node_cmd_configuration_info_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id,  znet_node_channel_id_t channel_id,
     znet_cmd_configuration_id_t param_number)
 {
-    if( !znet_cb )
+    if( !ctx )
     {
         ZNET_LOGE( "ZNET: Library not initialized!\n" );
         return;
@@ -403,19 +779,39 @@ void znet_node_cmd_configuration_info_get(
         encap |= Encapsulation_MuCh;
     }
 
-    if( !znet_cc_configuration_info_get( &znet, node_id, param_number,
+    /// INFO: known from a node of the same model
+    const znet_param_meta_t* meta = znet_param_db_get( ctx, node_id, param_number, 0 );
+    if( channel_id == ZNET_CHANNEL_ID_ROOT && meta && ( meta->flags & ZNET_PARAM_META_INFO ) )
+    {
+        _znet_configuration_text_dispatch( ctx, ZNET_EVENT_CONFIGURATION_INFO, node_id, channel_id,
+                                           param_number, ZNET_PARAM_META_INFO, meta->info );
+        return;
+    }
+
+    /// INFO: sleeping node gets it on its next wake up
+    znet_deferred_cmd_t deferred = {
+        .op = ZNET_DEFERRED_CONFIGURATION_INFO_GET, .node_id = node_id,
+        .channel_id = channel_id, .param = param_number };
+    int held = znet_deferred_hold( ctx, &deferred );
+    if( held < 0 )
+        _znet_configuration_request_failed( ctx, ZNET_EVENT_CONFIGURATION_INFO, node_id,
+                                            channel_id, param_number, ZNET_PARAM_META_INFO );
+    if( held )
+        return;
+
+    if( !znet_cc_configuration_info_get( &ctx->znet, node_id, param_number,
                                             NULL, callbackArg, encap  ) )
     {
-        if( znet_cb->node_cmd_configuration_info_result )
-            znet_cb->node_cmd_configuration_info_result(
-                                        -1, ZNET_NODE_ID_INVALID,
-                                        channel_id, NULL, znet_cb->arg );
+        _znet_configuration_request_failed( ctx, ZNET_EVENT_CONFIGURATION_INFO, node_id,
+                                            channel_id, param_number, ZNET_PARAM_META_INFO );
     }
 }
 
 void znet_cc_configuration_properties_report( const ZFunction func, uint8_t node_id,
                                    int cc_data_len, const uint8_t* cc_data  )
 {
+    znet_ctx_t* ctx = znet_main_ctx( func );
+
     assert( cc_data );
     assert( cc_data_len >= ZNET_CMD_CONFIGURATION_PROP_REPORT_CHECK_LEN );
     assert( cc_data[0] == ZNET_COMMAND_CLASS_CONFIGURATION );
@@ -424,39 +820,57 @@ void znet_cc_configuration_properties_report( const ZFunction func, uint8_t node
 
     if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
         return;
+    znet_health_contact( ctx, node_id );
 
+    /// INFO: Parameter Number 0 reports the first parameter as next
     uint16_t param_num = ((uint16_t)cc_data[2] << 8) | cc_data[3];
-    assert( param_num );
 
     size_t param_size = ( cc_data[4] & 0x07 ) * 0x03;
 
-    assert( cc_data_len >= ZNET_CMD_CONFIGURATION_PROP_REPORT_CHECK_LEN + param_size );
-
-    const size_t buff_size = sizeof( znet_configuration_properties_report_t ) + param_size;
-    uint8_t buff[buff_size];
-    memset( buff, 0, buff_size );
+    assert( (size_t)cc_data_len >= ZNET_CMD_CONFIGURATION_PROP_REPORT_CHECK_LEN + param_size );
 
-    znet_configuration_properties_report_t* prop_report =
-        (znet_configuration_properties_report_t*)&buff;
-    prop_report->param_number = param_num;
-    prop_report->data_format = ( cc_data[4] & CONFIGURATION_PROPERTIES_REPORT_PROPERTIES1_FORMAT_MASK_V4 ) >> \
+    znet_param_meta_t props;
+    memset( &props, 0, sizeof( props ) );
+    props.param_number = param_num;
+    props.data_format = ( cc_data[4] & CONFIGURATION_PROPERTIES_REPORT_PROPERTIES1_FORMAT_MASK_V4 ) >> \
         CONFIGURATION_PROPERTIES_REPORT_PROPERTIES1_FORMAT_SHIFT_V4;
-    prop_report->data_size = cc_data[4] & CONFIGURATION_PROPERTIES_REPORT_PROPERTIES1_SIZE_MASK_V4;
-    for (int i = 0; i < ( param_size + 2 ); i++)
-        prop_report->data[i] = cc_data[(ZNET_CMD_CONFIGURATION_PROP_REPORT_CHECK_LEN - 2) + i];
+    props.data_size = cc_data[4] & CONFIGURATION_PROPERTIES_REPORT_PROPERTIES1_SIZE_MASK_V4;
+
+    const uint8_t* data = &cc_data[ZNET_CMD_CONFIGURATION_PROP_REPORT_CHECK_LEN - 1];
+    props.min_value = znet_param_db_value( data, props.data_size, props.data_format );
+    data += props.data_size;
+    props.max_value = znet_param_db_value( data, props.data_size, props.data_format );
+    data += props.data_size;
+    props.default_value = znet_param_db_value( data, props.data_size, props.data_format );
+    data += props.data_size;
+    if( (size_t)cc_data_len >= ZNET_CMD_CONFIGURATION_PROP_REPORT_CHECK_LEN + 1 + param_size )
+        props.next_param = ((uint16_t)data[0] << 8) | data[1];
+
+    if( func->_endpoint == ZNET_CHANNEL_ID_ROOT && param_num )
+    {
+        znet_param_meta_t* meta = znet_param_db_get( ctx, node_id, param_num, 1 );
+        if( meta )
+        {
+            meta->next_param = props.next_param;
+            meta->data_format = props.data_format;
+            meta->data_size = props.data_size;
+            meta->min_value = props.min_value;
+            meta->max_value = props.max_value;
+            meta->default_value = props.default_value;
+            meta->flags |= ZNET_PARAM_META_PROPERTIES;
+            znet_param_db_dirty( ctx, node_id, meta );
+        }
+    }
 
-    /// TODO: check in storage node_id
     /// TODO: check wait report for node_id done!
-    if( znet_cb->node_cmd_configuration_properties_result )
-        znet_cb->node_cmd_configuration_properties_result( 0, node_id, func->_endpoint,
-                                                prop_report, znet_cb->arg );
+    _znet_configuration_properties_dispatch( ctx, node_id, func->_endpoint, &props );
 }
 
-void znet_node_cmd_configuration_properties_get(
-    znet_node_id_t node_id,  znet_node_channel_id_t channel_id,
+void znet_ctx_node_cmd_configuration_properties_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id,  znet_node_channel_id_t channel_id,
     znet_cmd_configuration_id_t param_number)
 {
-    if( !znet_cb )
+    if( !ctx )
     {
         ZNET_LOGE( "ZNET: Library not initialized!\n" );
         return;
@@ -476,21 +890,39 @@ void znet_node_cmd_configuration_properties_get(
         encap |= Encapsulation_MuCh;
     }
 
-    if( !znet_cc_configuration_properties_get( &znet, node_id, param_number,
+    /// INFO: known from a node of the same model
+    const znet_param_meta_t* meta = znet_param_db_get( ctx, node_id, param_number, 0 );
+    if( channel_id == ZNET_CHANNEL_ID_ROOT && meta &&
+        ( meta->flags & ZNET_PARAM_META_PROPERTIES ) )
+    {
+        _znet_configuration_properties_dispatch( ctx, node_id, channel_id, meta );
+        return;
+    }
+
+    /// INFO: sleeping node gets it on its next wake up
+    znet_deferred_cmd_t deferred = {
+        .op = ZNET_DEFERRED_CONFIGURATION_PROPERTIES_GET, .node_id = node_id,
+        .channel_id = channel_id, .param = param_number };
+    int held = znet_deferred_hold( ctx, &deferred );
+    if( held < 0 )
+        _znet_configuration_request_failed( ctx, ZNET_EVENT_CONFIGURATION_PROPERTIES, node_id,
+                                            channel_id, param_number, ZNET_PARAM_META_PROPERTIES );
+    if( held )
+        return;
+
+    if( !znet_cc_configuration_properties_get( &ctx->znet, node_id, param_number,
          NULL, callbackArg, encap  ) )
     {
-        if( znet_cb->node_cmd_configuration_properties_result )
-            znet_cb->node_cmd_configuration_properties_result(
-                                        -1, ZNET_NODE_ID_INVALID,
-                                        channel_id, NULL, znet_cb->arg );
+        _znet_configuration_request_failed( ctx, ZNET_EVENT_CONFIGURATION_PROPERTIES, node_id,
+                                            channel_id, param_number, ZNET_PARAM_META_PROPERTIES );
     }
 
 }
 
-void znet_node_cmd_configuration_default_reset(
-    znet_node_id_t node_id, znet_node_channel_id_t channel_id)
+void znet_ctx_node_cmd_configuration_default_reset(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id)
 {
-    if( !znet_cb )
+    if( !ctx )
     {
         ZNET_LOGE( "ZNET: Library not initialized!\n" );
         return;
@@ -502,6 +934,17 @@ void znet_node_cmd_configuration_default_reset(
         return;
     }
 
+    /// INFO: sleeping node gets it on its next wake up
+    znet_deferred_cmd_t deferred = {
+        .op = ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET, .node_id = node_id,
+        .channel_id = channel_id };
+    int held = znet_deferred_hold( ctx, &deferred );
+    if( held < 0 )
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_SET,
+                       -1, node_id, channel_id, NULL, 0 );
+    if( held )
+        return;
+
     znet_node_channel_id_t from_to[2] = { ZNET_CHANNEL_ID_ROOT, channel_id };
     void* callbackArg = NULL;
     encap_type_t encap = Encapsulation_None;
@@ -511,6 +954,78 @@ void znet_node_cmd_configuration_default_reset(
         encap |= Encapsulation_MuCh;
     }
 
-    znet_cc_configuration_default_reset(&znet, node_id, NULL, callbackArg, Encapsulation_None );
+    znet_cc_configuration_default_reset(&ctx->znet, node_id, NULL, callbackArg, Encapsulation_None );
+}
+
+/// INFO: API without explicit context, operates on the default context
+
+void znet_node_cmd_configuration_get(
+    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    uint8_t config_param_num )
+{
+    znet_ctx_node_cmd_configuration_get( znet_ctx_default, node_id,
+                                         channel_id, config_param_num );
+}
+
+void znet_node_cmd_configuration_set(
+    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    uint8_t config_param_num, uint8_t config_size,
+    int set_to_default, znet_cmd_configuration_value_t config_value)
+{
+    znet_ctx_node_cmd_configuration_set( znet_ctx_default, node_id, channel_id,
+                                         config_param_num, config_size,
+                                         set_to_default, config_value );
+}
+
+void znet_node_cmd_configuration_bulk_set(
+    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t config_id,
+    uint8_t config_count, uint8_t config_size,
+    int need_report, int set_to_default, const uint8_t* config_value)
+{
+    znet_ctx_node_cmd_configuration_bulk_set(
+        znet_ctx_default, node_id, channel_id, config_id, config_count,
+        config_size, need_report, set_to_default, config_value );
+}
+
+void znet_node_cmd_configuration_bulk_get(
+    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t config_id, uint8_t config_count)
+{
+    znet_ctx_node_cmd_configuration_bulk_get( znet_ctx_default, node_id,
+                                              channel_id, config_id,
+                                              config_count );
+}
+
+void znet_node_cmd_configuration_name_get(
+    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number)
+{
+    znet_ctx_node_cmd_configuration_name_get( znet_ctx_default, node_id,
+                                              channel_id, param_number );
+}
+
+void znet_node_cmd_configuration_info_get(
+    znet_node_id_t node_id,  znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number)
+{
+    znet_ctx_node_cmd_configuration_info_get( znet_ctx_default, node_id,
+                                              channel_id, param_number );
+}
+
+void znet_node_cmd_configuration_properties_get(
+    znet_node_id_t node_id,  znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number)
+{
+    znet_ctx_node_cmd_configuration_properties_get( znet_ctx_default, node_id,
+                                                    channel_id, param_number );
+}
+
+void znet_node_cmd_configuration_default_reset(
+    znet_node_id_t node_id, znet_node_channel_id_t channel_id)
+{
+    znet_ctx_node_cmd_configuration_default_reset( znet_ctx_default, node_id,
+                                                   channel_id );
 }
 
+#endif  // ZNET_CFG_CC_CONFIGURATION
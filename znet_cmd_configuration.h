@@ -0,0 +1,70 @@
+/**
+ * @file znet_cmd_configuration.h
+ * @date 18 Oct 2026
+ * @brief Configuration requests used by other modules.
+ */
+
+#ifndef ZNET_CMD_CONFIGURATION_H
+#define ZNET_CMD_CONFIGURATION_H
+
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration Get for a number of callers, see
+ * znet_ctx_node_cmd_configuration_get
+ *
+ * Every caller gets the report or the error. A replayed held GET brings the
+ * callers that were collapsed into it.
+ *
+ * @param waiters Number of callers, at least 1
+ */
+void znet_configuration_get( znet_ctx_t* ctx, znet_node_id_t node_id,
+                             znet_node_channel_id_t channel_id,
+                             uint8_t config_param_num, uint8_t waiters );
+
+/**
+ * @brief Fail callers of a Configuration Get
+ *
+ * The error carries the Parameter Number, so it reaches the awaiter of the
+ * report of that parameter.
+ */
+void znet_configuration_get_failed( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                    znet_node_channel_id_t channel_id,
+                                    uint8_t config_param_num, uint8_t waiters );
+
+/**
+ * @brief Configuration Set, see znet_ctx_node_cmd_configuration_set
+ *
+ * @return Return zero if the Set is sent or held. On error (invalid
+ * arguments, rejected or not sent), -1 is returned, a rejected or unsent Set
+ * also gets -1 in its result callback
+ */
+int znet_configuration_set( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            uint8_t config_param_num, uint8_t config_size,
+                            int set_to_default,
+                            znet_cmd_configuration_value_t config_value );
+
+/**
+ * @brief Configuration Bulk Set, see znet_ctx_node_cmd_configuration_bulk_set
+ *
+ * @return As znet_configuration_set
+ */
+int znet_configuration_bulk_set( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                 znet_node_channel_id_t channel_id,
+                                 znet_cmd_configuration_id_t config_id,
+                                 uint8_t config_count, uint8_t config_size,
+                                 int need_report, int set_to_default,
+                                 const uint8_t* config_value );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_CMD_CONFIGURATION_H
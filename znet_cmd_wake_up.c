@@ -0,0 +1,41 @@
+/**
+ * @file znet_cmd_wake_up.c
+ * @date 18 Oct 2026
+ * @brief Wake Up Command Class.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_deferred.h"
+#include "znet_health.h"
+
+/// INFO: internal
+#include <znet_lib.h>
+#include <znet_lib_cc_application.h>
+
+#if ZNET_CFG_CC_WAKE_UP
+
+/// INFO: Wake Up Notification Command Class v1
+void znet_cc_wake_up_notification( const ZFunction func, uint8_t node_id,
+                                   int cc_data_len, const uint8_t* cc_data )
+{
+    (void)cc_data_len;
+    (void)cc_data;
+
+    znet_ctx_t* ctx = znet_main_ctx( func );
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
+        return;
+
+    ZNET_LOGD( "ZNET: Node %u is awake\n", node_id );
+    znet_health_contact( ctx, node_id );
+    znet_deferred_wakeup( ctx, node_id );
+}
+
+#endif  // ZNET_CFG_CC_WAKE_UP
@@ -0,0 +1,153 @@
+/**
+ * @file znet_config.h
+ * @date 18 Oct 2026
+ * @brief Build configuration: command classes compiled into the library.
+ *
+ * Every option defaults to enabled. Define it to 0 with the compiler
+ * (-DZNET_CFG_CC_METER=0) or in the header named by ZNET_CFG_USER_HEADER
+ * (-DZNET_CFG_USER_HEADER='"my_znet_config.h"'). The application must be
+ * built with the same options: they change the layout of znet_callbacks_t.
+ */
+
+#ifndef ZNET_CONFIG_H
+#define ZNET_CONFIG_H
+
+#ifdef ZNET_CFG_USER_HEADER
+#include ZNET_CFG_USER_HEADER
+#endif
+
+/// INFO: command classes
+
+#ifndef ZNET_CFG_CC_VERSION
+#define ZNET_CFG_CC_VERSION 1
+#endif
+
+#ifndef ZNET_CFG_CC_MANUFACTURER_SPECIFIC
+#define ZNET_CFG_CC_MANUFACTURER_SPECIFIC 1
+#endif
+
+#ifndef ZNET_CFG_CC_DEVICE_SPECIFIC
+#define ZNET_CFG_CC_DEVICE_SPECIFIC 1
+#endif
+
+#ifndef ZNET_CFG_CC_ZWAVEPLUS_INFO
+#define ZNET_CFG_CC_ZWAVEPLUS_INFO 1
+#endif
+
+#ifndef ZNET_CFG_CC_BASIC
+#define ZNET_CFG_CC_BASIC 1
+#endif
+
+#ifndef ZNET_CFG_CC_BINARY_SWITCH
+#define ZNET_CFG_CC_BINARY_SWITCH 1
+#endif
+
+#ifndef ZNET_CFG_CC_MULTILEVEL_SWITCH
+#define ZNET_CFG_CC_MULTILEVEL_SWITCH 1
+#endif
+
+/**
+ * @brief Meter, with the history of values (znet_ctx_meter_series_*)
+ */
+#ifndef ZNET_CFG_CC_METER
+#define ZNET_CFG_CC_METER 1
+#endif
+
+#ifndef ZNET_CFG_CC_MULTICHANNEL
+#define ZNET_CFG_CC_MULTICHANNEL 1
+#endif
+
+/**
+ * @brief Configuration, with the parameters metadata and discovery
+ */
+#ifndef ZNET_CFG_CC_CONFIGURATION
+#define ZNET_CFG_CC_CONFIGURATION 1
+#endif
+
+/**
+ * @brief Wake Up: held commands are flushed on Wake Up Notification
+ */
+#ifndef ZNET_CFG_CC_WAKE_UP
+#define ZNET_CFG_CC_WAKE_UP 1
+#endif
+
+/// INFO: memory
+
+/**
+ * @brief No allocation after startup: contexts and all buffers come from
+ * static pools of the sizes below, ZNET_ALLOC is not used. A full pool fails
+ * the request with an error result.
+ */
+#ifndef ZNET_CFG_STATIC_MEMORY
+#define ZNET_CFG_STATIC_MEMORY 0
+#endif
+
+/**
+ * @brief Number of contexts (static memory)
+ */
+#ifndef ZNET_CFG_STATIC_CTX_MAX
+#define ZNET_CFG_STATIC_CTX_MAX 1
+#endif
+
+/**
+ * @brief Device models in the parameters metadata (static memory)
+ */
+#ifndef ZNET_CFG_STATIC_PARAM_MODELS
+#define ZNET_CFG_STATIC_PARAM_MODELS 8
+#endif
+
+/**
+ * @brief Parameters of one device model (static memory)
+ */
+#ifndef ZNET_CFG_STATIC_PARAM_PER_MODEL
+#define ZNET_CFG_STATIC_PARAM_PER_MODEL 32
+#endif
+
+/**
+ * @brief Parameters found by one configuration discovery (static memory)
+ */
+#ifndef ZNET_CFG_STATIC_WALK_PARAMS
+#define ZNET_CFG_STATIC_WALK_PARAMS 32
+#endif
+
+/**
+ * @brief Bytes of one configuration backup (static memory), a restore takes
+ * twice the size of its backup
+ */
+#ifndef ZNET_CFG_STATIC_BACKUP_BYTES
+#define ZNET_CFG_STATIC_BACKUP_BYTES 512
+#endif
+
+/**
+ * @brief Reports too big for a dispatch event queued at the same time (static
+ * memory)
+ */
+#ifndef ZNET_CFG_STATIC_DISPATCH_REPORTS
+#define ZNET_CFG_STATIC_DISPATCH_REPORTS 2
+#endif
+
+/**
+ * @brief Raw samples ring of one meter series, bytes (static memory)
+ */
+#ifndef ZNET_CFG_STATIC_METER_RAW_BYTES
+#define ZNET_CFG_STATIC_METER_RAW_BYTES 256
+#endif
+
+/**
+ * @brief Buckets of one rollup level of meter series (static memory)
+ */
+#ifndef ZNET_CFG_STATIC_METER_ROLLUPS
+#define ZNET_CFG_STATIC_METER_ROLLUPS 24
+#endif
+
+/// INFO: tables
+
+/**
+ * @brief Last known values of all nodes kept by the context (power of 2),
+ * see znet_ctx_state_read
+ */
+#ifndef ZNET_CFG_STATE_MAX
+#define ZNET_CFG_STATE_MAX 512
+#endif
+
+#endif  // ZNET_CONFIG_H
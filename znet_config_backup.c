@@ -0,0 +1,535 @@
+/**
+ * @file znet_config_backup.c
+ * @date 18 Oct 2026
+ * @brief Backup of configuration parameters and restore of the differences.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_dispatch.h"
+#include "znet_deferred.h"
+#include "znet_param_db.h"
+#include "znet_config_backup.h"
+#include "znet_cmd_configuration.h"
+#include "znet_rtt.h"
+#include "znet_mem.h"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+/// INFO: Parameter Offset, Number of Parameters, Size
+#define ZNET_CONFIG_BACKUP_RUN_HEADER 4
+
+static int _znet_config_backup_size_valid( uint8_t size )
+{
+    return size == 1 || size == 2 || size == 4;
+}
+
+static uint16_t _znet_config_backup_first( const uint8_t* run )
+{
+    return ( (uint16_t)run[0] << 8 ) | run[1];
+}
+
+static size_t _znet_config_backup_run_size( const uint8_t* run )
+{
+    return ZNET_CONFIG_BACKUP_RUN_HEADER + (size_t)run[2] * run[3];
+}
+
+static znet_config_backup_t* _znet_config_backup_find(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id )
+{
+    for( size_t i = 0; i < ZNET_CONFIG_BACKUP_MAX; i++ )
+    {
+        znet_config_backup_t* job = &ctx->backups[i];
+        if( job->node_id == node_id && job->channel_id == channel_id )
+            return job;
+    }
+    return NULL;
+}
+
+/// INFO: runs of the discovered parameters, only the size if data is NULL
+static size_t _znet_config_backup_layout( const znet_param_model_t* model,
+                                          uint8_t* data, uint16_t* count )
+{
+    size_t size = 1;
+    size_t run = 0;
+    uint8_t run_count = 0;
+    const znet_param_meta_t* prev = NULL;
+
+    if( data )
+        data[0] = ZNET_CONFIGURATION_BACKUP_FORMAT;
+    *count = 0;
+
+    for( uint16_t i = 0; i < model->count; i++ )
+    {
+        const znet_param_meta_t* meta = &model->params[i];
+        if( !meta->param_number || !( meta->flags & ZNET_PARAM_META_PROPERTIES ) ||
+            !_znet_config_backup_size_valid( meta->data_size ) )
+            continue;
+
+        if( !prev || meta->param_number != prev->param_number + 1 ||
+            meta->data_size != prev->data_size || run_count == UINT8_MAX )
+        {
+            run = size;
+            run_count = 0;
+            size += ZNET_CONFIG_BACKUP_RUN_HEADER;
+            if( data )
+            {
+                data[run] = meta->param_number >> 8;
+                data[run + 1] = meta->param_number & 0xFF;
+                data[run + 3] = meta->data_size;
+            }
+        }
+
+        run_count++;
+        if( data )
+            data[run + 2] = run_count;
+        size += meta->data_size;
+        prev = meta;
+        ( *count )++;
+    }
+    return size;
+}
+
+static int _znet_config_backup_parse( const uint8_t* data, size_t size,
+                                      uint16_t* count )
+{
+    if( !data || size < 1 || size > UINT16_MAX ||
+        data[0] != ZNET_CONFIGURATION_BACKUP_FORMAT )
+        return -1;
+
+    *count = 0;
+    for( size_t pos = 1; pos < size; )
+    {
+        if( size - pos < ZNET_CONFIG_BACKUP_RUN_HEADER )
+            return -1;
+
+        const uint8_t* run = &data[pos];
+        uint16_t first = _znet_config_backup_first( run );
+        if( !first || !run[2] || !_znet_config_backup_size_valid( run[3] ) ||
+            (uint32_t)first + run[2] - 1 > UINT16_MAX ||
+            size - pos < _znet_config_backup_run_size( run ) )
+            return -1;
+
+        *count += run[2];
+        pos += _znet_config_backup_run_size( run );
+    }
+    return *count ? 0 : -1;
+}
+
+static void _znet_config_backup_release( znet_ctx_t* ctx,
+                                         znet_config_backup_t* job )
+{
+    znet_mem_alloc( ctx, ZNET_MEM_TAG_BACKUP, job->report, 0 );
+    job->report = NULL;
+    job->node_id = ZNET_NODE_ID_INVALID;
+}
+
+static void _znet_config_backup_finish(
+    znet_ctx_t* ctx, znet_config_backup_t* job, int err,
+    const znet_configuration_restore_report_t* result )
+{
+    znet_node_id_t node_id = job->node_id;
+    znet_node_channel_id_t channel_id = job->channel_id;
+    znet_configuration_backup_report_t* report = job->report;
+
+    /// INFO: slot is free before the callback, it may start a new backup
+    job->node_id = ZNET_NODE_ID_INVALID;
+    job->report = NULL;
+    if( job->restore )
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_RESTORE, err, node_id,
+                       channel_id, result, result ? sizeof( *result ) : 0 );
+    else if( err )
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BACKUP, err, node_id,
+                       channel_id, NULL, 0 );
+    else
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BACKUP, 0, node_id,
+                       channel_id, report,
+                       sizeof( znet_configuration_backup_report_t ) + report->size );
+    znet_mem_alloc( ctx, ZNET_MEM_TAG_BACKUP, report, 0 );
+}
+
+/// INFO: ask for the rest of the run being read
+static int _znet_config_backup_send( znet_ctx_t* ctx, znet_config_backup_t* job )
+{
+    const uint8_t* run = &job->report->data[job->run];
+    uint16_t param = _znet_config_backup_first( run ) + job->got;
+
+    job->tx_time = ctx->cb->clock( ctx->cb->arg );
+    if( !job->single )
+    {
+        znet_ctx_node_cmd_configuration_bulk_get( ctx, job->node_id,
+                                                  job->channel_id, param,
+                                                  run[2] - job->got );
+        return 0;
+    }
+
+    /// INFO: Configuration Get of v1 has 8 bit Parameter Number
+    if( param > UINT8_MAX )
+    {
+        ZNET_LOGW( "ZNET: Parameter %u of node %u needs Bulk Get!\n", param,
+                   job->node_id );
+        return -1;
+    }
+    znet_ctx_node_cmd_configuration_get( ctx, job->node_id, job->channel_id,
+                                         (uint8_t)param );
+    return 0;
+}
+
+static int _znet_config_backup_set( znet_ctx_t* ctx, znet_config_backup_t* job,
+                                    uint16_t param, uint8_t count, uint8_t size,
+                                    const uint8_t* values )
+{
+    if( job->single )
+        return znet_configuration_set(
+            ctx, job->node_id, job->channel_id, (uint8_t)param, size, 0,
+            (uint32_t)znet_param_db_value( values, size,
+                                           ZNET_CMD_CONFIGURATION_FORMAT_UNSIGNED ) );
+    return znet_configuration_bulk_set( ctx, job->node_id, job->channel_id,
+                                        param, count, size, 0, 0, values );
+}
+
+/// INFO: values of node are read, write the differing ones of the source
+static void _znet_config_backup_write( znet_ctx_t* ctx, znet_config_backup_t* job )
+{
+    const znet_configuration_backup_report_t* report = job->report;
+    const uint8_t* source = &report->data[report->size];
+    znet_configuration_restore_report_t result = { .count = report->count };
+    int err = 0;
+
+    for( size_t pos = 1; !err && pos < report->size;
+         pos += _znet_config_backup_run_size( &source[pos] ) )
+    {
+        const uint8_t* run = &source[pos];
+        uint16_t first = _znet_config_backup_first( run );
+        uint8_t count = run[2];
+        uint8_t size = run[3];
+        const uint8_t* want = &run[ZNET_CONFIG_BACKUP_RUN_HEADER];
+        const uint8_t* have = &report->data[pos + ZNET_CONFIG_BACKUP_RUN_HEADER];
+
+        /// INFO: a held Bulk Set keeps ZNET_DEFERRED_DATA_MAX bytes
+        uint16_t max = job->single ? 1 : ZNET_DEFERRED_DATA_MAX / size;
+        for( uint16_t i = 0; !err && i < count; )
+        {
+            if( !memcmp( &have[i * size], &want[i * size], size ) )
+            {
+                i++;
+                continue;
+            }
+
+            /// INFO: a short gap of equal values is cheaper than a new frame
+            uint16_t end = i + 1;
+            uint16_t changed = 1;
+            for( uint16_t j = end; j < count && j - i < max; j++ )
+            {
+                if( memcmp( &have[j * size], &want[j * size], size ) )
+                {
+                    changed++;
+                    end = j + 1;
+                }
+                else if( ( j + 1 - end ) * size > ZNET_CONFIG_BACKUP_GAP_MAX )
+                    break;
+            }
+
+            /// INFO: the result tells what was written before the rejected Set
+            if( _znet_config_backup_set( ctx, job, first + i, (uint8_t)( end - i ),
+                                         size, &want[i * size] ) )
+            {
+                ZNET_LOGE( "ZNET: Set %u of restore of node %u is rejected!\n",
+                           first + i, job->node_id );
+                err = -1;
+                break;
+            }
+            result.changed += changed;
+            result.frames++;
+            i = end;
+        }
+    }
+
+    ZNET_LOGI( "ZNET: Restore of node %u: %u of %u parameters in %u frames\n",
+               job->node_id, result.changed, result.count, result.frames );
+    _znet_config_backup_finish( ctx, job, err, &result );
+}
+
+static void _znet_config_backup_next( znet_ctx_t* ctx, znet_config_backup_t* job )
+{
+    job->run += (uint16_t)_znet_config_backup_run_size( &job->report->data[job->run] );
+    job->got = 0;
+    job->retries = 0;
+
+    if( job->run < job->report->size )
+    {
+        if( _znet_config_backup_send( ctx, job ) )
+            _znet_config_backup_finish( ctx, job, -1, NULL );
+        return;
+    }
+
+    if( job->restore )
+        _znet_config_backup_write( ctx, job );
+    else
+        _znet_config_backup_finish( ctx, job, 0, NULL );
+}
+
+static znet_config_backup_t* _znet_config_backup_start(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    uint8_t restore, size_t size )
+{
+    if( _znet_config_backup_find( ctx, node_id, channel_id ) )
+        return NULL;
+
+    znet_config_backup_t* job = NULL;
+    for( size_t i = 0; !job && i < ZNET_CONFIG_BACKUP_MAX; i++ )
+        if( ctx->backups[i].node_id == ZNET_NODE_ID_INVALID )
+            job = &ctx->backups[i];
+    if( !job )
+        return NULL;
+
+    /// INFO: restore keeps the source behind the values being read
+    znet_configuration_backup_report_t* report =
+        (znet_configuration_backup_report_t*)znet_mem_alloc(
+            ctx, ZNET_MEM_TAG_BACKUP, NULL,
+            sizeof( znet_configuration_backup_report_t ) +
+                ( restore ? 2 : 1 ) * size );
+    if( !report )
+        return NULL;
+
+    memset( report, 0, sizeof( znet_configuration_backup_report_t ) + size );
+    report->size = (uint16_t)size;
+
+    memset( job, 0, sizeof( znet_config_backup_t ) );
+    job->node_id = node_id;
+    job->channel_id = channel_id;
+    job->restore = restore;
+    job->report = report;
+    job->run = 1;
+    return job;
+}
+
+void znet_config_backup_init( znet_ctx_t* ctx )
+{
+    for( size_t i = 0; i < ZNET_CONFIG_BACKUP_MAX; i++ )
+    {
+        memset( &ctx->backups[i], 0, sizeof( znet_config_backup_t ) );
+        ctx->backups[i].node_id = ZNET_NODE_ID_INVALID;
+    }
+}
+
+void znet_config_backup_free( znet_ctx_t* ctx )
+{
+    for( size_t i = 0; i < ZNET_CONFIG_BACKUP_MAX; i++ )
+        if( ctx->backups[i].node_id != ZNET_NODE_ID_INVALID )
+            _znet_config_backup_release( ctx, &ctx->backups[i] );
+}
+
+void znet_config_backup_proc( znet_ctx_t* ctx )
+{
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    for( size_t i = 0; i < ZNET_CONFIG_BACKUP_MAX; i++ )
+    {
+        znet_config_backup_t* job = &ctx->backups[i];
+        if( job->node_id == ZNET_NODE_ID_INVALID )
+            continue;
+
+        if( ctx->health.nodes[job->node_id].failed )
+        {
+            ZNET_LOGW( "ZNET: Configuration backup of failed node %u!\n",
+                       job->node_id );
+            _znet_config_backup_finish( ctx, job, -1, NULL );
+            continue;
+        }
+
+        if( now - job->tx_time <= znet_rtt_timeout( ctx, job->node_id ) )
+            continue;
+
+        /// INFO: requests wait for the wake up of node, but not forever
+        if( znet_ctx_node_deferred_count( ctx, job->node_id ) )
+        {
+            if( !job->wait_time )
+                job->wait_time = now;
+            if( now - job->wait_time < ZNET_CONFIG_BACKUP_WAKE_UP_MS )
+            {
+                job->tx_time = now;
+                continue;
+            }
+
+            ZNET_LOGW( "ZNET: Node %u did not wake up for configuration backup!\n",
+                       job->node_id );
+            _znet_config_backup_finish( ctx, job, -1, NULL );
+            continue;
+        }
+        job->wait_time = 0;
+
+        /// INFO: no Bulk Report to a few Bulk Gets - Configuration Command
+        /// Class v1, a single lost frame is only repeated
+        if( !job->single && !job->answered &&
+            job->retries >= ZNET_CONFIG_BACKUP_RETRIES )
+        {
+            ZNET_LOGI( "ZNET: Node %u does not answer Bulk Get, reading "
+                       "parameters one by one\n", job->node_id );
+            job->single = 1;
+            job->retries = 0;
+        }
+        else if( ++job->retries > ZNET_CONFIG_BACKUP_RETRIES )
+        {
+            ZNET_LOGW( "ZNET: Configuration backup of node %u timed out!\n",
+                       job->node_id );
+            _znet_config_backup_finish( ctx, job, -1, NULL );
+            continue;
+        }
+
+        if( _znet_config_backup_send( ctx, job ) )
+            _znet_config_backup_finish( ctx, job, -1, NULL );
+    }
+}
+
+void znet_config_backup_values( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                znet_node_channel_id_t channel_id,
+                                znet_cmd_configuration_id_t param_number,
+                                uint8_t count, uint8_t size,
+                                const uint8_t* data, uint8_t rep_to_follows,
+                                int bulk )
+{
+    znet_config_backup_t* job = _znet_config_backup_find( ctx, node_id, channel_id );
+    if( !job )
+        return;
+
+    uint8_t* run = &job->report->data[job->run];
+    uint32_t expected = (uint32_t)_znet_config_backup_first( run ) + job->got;
+    if( param_number > expected || (uint32_t)param_number + count <= expected )
+        return;
+
+    if( size != run[3] )
+    {
+        ZNET_LOGW( "ZNET: Size of parameter %u of node %u is %u, not %u!\n",
+                   (unsigned)expected, node_id, size, run[3] );
+        _znet_config_backup_finish( ctx, job, -1, NULL );
+        return;
+    }
+
+    /// INFO: values before the expected one were received already
+    uint8_t skip = (uint8_t)( expected - param_number );
+    uint8_t n = count - skip;
+    if( n > run[2] - job->got )
+        n = run[2] - job->got;
+
+    memcpy( &run[ZNET_CONFIG_BACKUP_RUN_HEADER + job->got * size],
+            &data[skip * size], (size_t)n * size );
+    job->got += n;
+    job->retries = 0;
+    job->answered |= bulk ? 1 : 0;
+    job->tx_time = ctx->cb->clock( ctx->cb->arg );
+    job->wait_time = 0;
+
+    if( job->got == run[2] )
+    {
+        _znet_config_backup_next( ctx, job );
+        return;
+    }
+
+    /// INFO: node answered a part of the run, ask for the rest
+    if( !rep_to_follows && _znet_config_backup_send( ctx, job ) )
+        _znet_config_backup_finish( ctx, job, -1, NULL );
+}
+
+void znet_ctx_node_cmd_configuration_backup( znet_ctx_t* ctx,
+                                             znet_node_id_t node_id,
+                                             znet_node_channel_id_t channel_id )
+{
+    if( !ctx )
+    {
+        ZNET_LOGE( "ZNET: Library not initialized!\n" );
+        return;
+    }
+
+    /// INFO: the metadata is stored for the root channel only
+    const znet_param_model_t* model = NULL;
+    if( node_id >= ZNET_NODE_ID_MIN && node_id <= ZNET_NODE_ID_MAX &&
+        channel_id == ZNET_CHANNEL_ID_ROOT )
+        model = znet_param_db_model( ctx, node_id );
+
+    uint16_t count = 0;
+    size_t size = model ? _znet_config_backup_layout( model, NULL, &count ) : 0;
+    if( !count || size > UINT16_MAX )
+    {
+        ZNET_LOGE( "ZNET: Parameters of node %u are not discovered!\n", node_id );
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BACKUP,
+                       -1, node_id, channel_id, NULL, 0 );
+        return;
+    }
+
+    znet_config_backup_t* job =
+        _znet_config_backup_start( ctx, node_id, channel_id, 0, size );
+    if( !job )
+    {
+        ZNET_LOGE( "ZNET: Configuration backup is not started!\n" );
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_BACKUP,
+                       -1, node_id, channel_id, NULL, 0 );
+        return;
+    }
+
+    _znet_config_backup_layout( model, job->report->data, &job->report->count );
+    if( _znet_config_backup_send( ctx, job ) )
+        _znet_config_backup_finish( ctx, job, -1, NULL );
+}
+
+void znet_ctx_node_cmd_configuration_restore(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    const uint8_t* data, size_t size )
+{
+    if( !ctx )
+    {
+        ZNET_LOGE( "ZNET: Library not initialized!\n" );
+        return;
+    }
+
+    uint16_t count = 0;
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX ||
+        _znet_config_backup_parse( data, size, &count ) )
+    {
+        ZNET_LOGE( "ZNET: Invalid configuration backup!\n" );
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_RESTORE,
+                       -1, node_id, channel_id, NULL, 0 );
+        return;
+    }
+
+    znet_config_backup_t* job =
+        _znet_config_backup_start( ctx, node_id, channel_id, 1, size );
+    if( !job )
+    {
+        ZNET_LOGE( "ZNET: Configuration restore is not started!\n" );
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_RESTORE,
+                       -1, node_id, channel_id, NULL, 0 );
+        return;
+    }
+
+    /// INFO: runs of the source are read from node into the same layout
+    memcpy( job->report->data, data, size );
+    memcpy( &job->report->data[size], data, size );
+    job->report->count = count;
+    if( _znet_config_backup_send( ctx, job ) )
+        _znet_config_backup_finish( ctx, job, -1, NULL );
+}
+
+void znet_node_cmd_configuration_backup( znet_node_id_t node_id,
+                                         znet_node_channel_id_t channel_id )
+{
+    znet_ctx_node_cmd_configuration_backup( znet_ctx_default, node_id,
+                                            channel_id );
+}
+
+void znet_node_cmd_configuration_restore( znet_node_id_t node_id,
+                                          znet_node_channel_id_t channel_id,
+                                          const uint8_t* data, size_t size )
+{
+    znet_ctx_node_cmd_configuration_restore( znet_ctx_default, node_id,
+                                             channel_id, data, size );
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
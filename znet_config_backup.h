@@ -0,0 +1,98 @@
+/**
+ * @file znet_config_backup.h
+ * @date 18 Oct 2026
+ * @brief Backup of configuration parameters and restore of the differences.
+ */
+
+#ifndef ZNET_CONFIG_BACKUP_H
+#define ZNET_CONFIG_BACKUP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max number of backups and restores at the same time
+ */
+#define ZNET_CONFIG_BACKUP_MAX 2
+
+/**
+ * @brief Requests of the same parameters without an answer before failure,
+ * Bulk Gets before reading one by one
+ */
+#define ZNET_CONFIG_BACKUP_RETRIES 2
+
+/**
+ * @brief Max wait for the wake up of node with held requests (ms), the slot
+ * is not taken forever
+ */
+#define ZNET_CONFIG_BACKUP_WAKE_UP_MS ( 60 * 60 * 1000 )
+
+/**
+ * @brief Bytes of equal values written again to merge two Bulk Sets, about
+ * the cost of one more frame
+ */
+#define ZNET_CONFIG_BACKUP_GAP_MAX 8
+
+/**
+ * @brief Backup or restore of one node
+ *
+ * The values are read run by run into the serialized backup. A restore keeps
+ * the source backup behind it, in the same layout, and compares the two when
+ * all runs are read.
+ */
+typedef struct znet_config_backup_t
+{
+    znet_node_id_t node_id;            /**< Node ID, INVALID - free slot */
+    znet_node_channel_id_t channel_id; /**< Channel ID */
+    uint8_t restore;                   /**< flag: restore, else backup */
+    uint8_t single;                    /**< flag: no Bulk Get, read one by one */
+    uint8_t answered;                  /**< flag: a Bulk Report arrived */
+    uint8_t retries;                   /**< Requests without answer */
+    uint16_t run;                      /**< Offset of run being read in data */
+    uint8_t got;                       /**< Values of the run received */
+    uint64_t tx_time;                  /**< Time of last request/report (ms) */
+    uint64_t wait_time;                /**< Start of wait for wake up (ms),
+                                            0 - not waiting */
+    znet_configuration_backup_report_t* report; /**< Values being read */
+} znet_config_backup_t;
+
+/**
+ * @brief Init backup state
+ */
+void znet_config_backup_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Abort all backups and restores and release memory
+ */
+void znet_config_backup_free( znet_ctx_t* ctx );
+
+/**
+ * @brief Repeat unanswered requests, fall back to Configuration Get
+ */
+void znet_config_backup_proc( znet_ctx_t* ctx );
+
+/**
+ * @brief Feed values of Report/Bulk Report to the backup of node
+ *
+ * @param data Values, size bytes each, MSB first
+ * @param rep_to_follows Reports to follow (Bulk Report), 0 - last
+ * @param bulk Flag: Bulk Report, else Report (Configuration v1)
+ */
+void znet_config_backup_values( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                znet_node_channel_id_t channel_id,
+                                znet_cmd_configuration_id_t param_number,
+                                uint8_t count, uint8_t size,
+                                const uint8_t* data, uint8_t rep_to_follows,
+                                int bulk );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_CONFIG_BACKUP_H
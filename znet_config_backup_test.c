@@ -0,0 +1,407 @@
+/**
+ * @file znet_config_backup_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of configuration backup and restore.
+ *
+ * The module is built into the test, the calls it makes to other modules are
+ * recorded by fakes. Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_config_backup_test.c -o znet_config_backup_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_config_backup.c"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+#define TEST_NODE 5
+#define TEST_CALLS_MAX 16
+
+/// INFO: request or Set sent by the module
+typedef struct test_call_t
+{
+    int bulk;      /**< flag: Bulk Get/Set, else Get/Set */
+    int set;       /**< flag: Set, else Get */
+    uint16_t param;
+    uint8_t count;
+    uint8_t size;
+    uint8_t values[ZNET_DEFERRED_DATA_MAX];
+} test_call_t;
+
+static struct
+{
+    uint64_t now;
+    test_call_t calls[TEST_CALLS_MAX];
+    size_t count;
+    int reject_set;
+    znet_event_type_t event;
+    int err;
+    uint8_t report[512];
+    size_t size;
+    size_t events;
+    znet_param_model_t* model;
+} test;
+
+znet_ctx_t* znet_ctx_default = NULL;
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return test.now;
+}
+
+static test_call_t* _test_call( int bulk, int set, uint16_t param,
+                                uint8_t count, uint8_t size )
+{
+    assert( test.count < TEST_CALLS_MAX );
+    test_call_t* call = &test.calls[test.count++];
+    memset( call, 0, sizeof( *call ) );
+    call->bulk = bulk;
+    call->set = set;
+    call->param = param;
+    call->count = count;
+    call->size = size;
+    return call;
+}
+
+void znet_dispatch( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+                    const void* value, size_t size )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    assert( size <= sizeof( test.report ) );
+    test.event = type;
+    test.err = err;
+    test.size = value ? size : 0;
+    if( value )
+        memcpy( test.report, value, size );
+    test.events++;
+}
+
+void znet_ctx_node_cmd_configuration_get( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                          znet_node_channel_id_t channel_id,
+                                          uint8_t config_param_num )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    _test_call( 0, 0, config_param_num, 1, 0 );
+}
+
+void znet_ctx_node_cmd_configuration_bulk_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t config_id, uint8_t config_count )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    _test_call( 1, 0, config_id, config_count, 0 );
+}
+
+int znet_configuration_set( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            uint8_t config_param_num, uint8_t config_size,
+                            int set_to_default,
+                            znet_cmd_configuration_value_t config_value )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    (void)set_to_default;
+    test_call_t* call = _test_call( 0, 1, config_param_num, 1, config_size );
+    for( uint8_t i = 0; i < config_size; i++ )
+        call->values[i] = (uint8_t)( config_value >> ( ( config_size - 1 - i ) * 8 ) );
+    return test.reject_set ? -1 : 0;
+}
+
+int znet_configuration_bulk_set( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                 znet_node_channel_id_t channel_id,
+                                 znet_cmd_configuration_id_t config_id,
+                                 uint8_t config_count, uint8_t config_size,
+                                 int need_report, int set_to_default,
+                                 const uint8_t* config_value )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    (void)need_report;
+    (void)set_to_default;
+    test_call_t* call = _test_call( 1, 1, config_id, config_count, config_size );
+    assert( (size_t)config_count * config_size <= sizeof( call->values ) );
+    memcpy( call->values, config_value, (size_t)config_count * config_size );
+    return test.reject_set ? -1 : 0;
+}
+
+int32_t znet_param_db_value( const uint8_t* data, uint8_t size, uint8_t format )
+{
+    (void)format;
+    uint32_t value = 0;
+    for( uint8_t i = 0; i < size; i++ )
+        value = ( value << 8 ) | data[i];
+    return (int32_t)value;
+}
+
+znet_param_model_t* znet_param_db_model( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    return node_id == TEST_NODE ? test.model : NULL;
+}
+
+uint32_t znet_rtt_timeout( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+    return 1000;
+}
+
+size_t znet_ctx_node_deferred_count( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+    return 0;
+}
+
+void* znet_mem_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag, void* ptr, size_t size )
+{
+    (void)ctx;
+    (void)tag;
+    if( !size )
+    {
+        free( ptr );
+        return NULL;
+    }
+    return realloc( ptr, size );
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_config_backup_init( &_test_ctx );
+    return &_test_ctx;
+}
+
+static void _test_meta( znet_param_meta_t* meta, uint16_t param, uint8_t size )
+{
+    memset( meta, 0, sizeof( *meta ) );
+    meta->param_number = param;
+    meta->data_size = size;
+    meta->flags = ZNET_PARAM_META_PROPERTIES;
+}
+
+/// INFO: consecutive parameters of the same size share a run
+static void _test_layout( void )
+{
+    znet_param_meta_t params[6];
+    _test_meta( &params[0], 1, 1 );
+    _test_meta( &params[1], 2, 1 );
+    _test_meta( &params[2], 3, 2 );
+    _test_meta( &params[3], 5, 2 );
+    _test_meta( &params[4], 6, 3 ); /// INFO: invalid size, skipped
+    _test_meta( &params[5], 300, 4 );
+    znet_param_model_t model = { .count = 6, .params = params };
+
+    uint16_t count = 0;
+    size_t size = _znet_config_backup_layout( &model, NULL, &count );
+    const uint8_t expected[] = { ZNET_CONFIGURATION_BACKUP_FORMAT,
+                                 0, 1, 2, 1, 0, 0,
+                                 0, 3, 1, 2, 0, 0,
+                                 0, 5, 1, 2, 0, 0,
+                                 0x01, 0x2C, 1, 4, 0, 0, 0, 0 };
+    assert( count == 5 );
+    assert( size == sizeof( expected ) );
+
+    uint8_t data[sizeof( expected )];
+    memset( data, 0, sizeof( data ) );
+    assert( _znet_config_backup_layout( &model, data, &count ) == size );
+    assert( !memcmp( data, expected, size ) );
+    assert( !_znet_config_backup_parse( data, size, &count ) && count == 5 );
+}
+
+static void _test_parse( void )
+{
+    uint16_t count = 0;
+    const uint8_t good[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0, 1, 2, 2,
+                             0, 1, 0, 2 };
+    assert( !_znet_config_backup_parse( good, sizeof( good ), &count ) );
+    assert( count == 2 );
+
+    /// INFO: format, empty, short run, size, Parameter Number 0, overflow
+    const uint8_t format[] = { 0x7F, 0, 1, 1, 1, 0 };
+    const uint8_t empty[] = { ZNET_CONFIGURATION_BACKUP_FORMAT };
+    const uint8_t cut[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0, 1, 2, 2, 0, 1 };
+    const uint8_t header[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0, 1, 1 };
+    const uint8_t size3[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0, 1, 1, 3, 0, 0, 0 };
+    const uint8_t zero[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0, 0, 1, 1, 0 };
+    const uint8_t none[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0, 1, 0, 1 };
+    const uint8_t wrap[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0xFF, 0xFF, 2, 1, 0, 0 };
+    assert( _znet_config_backup_parse( NULL, 0, &count ) );
+    assert( _znet_config_backup_parse( format, sizeof( format ), &count ) );
+    assert( _znet_config_backup_parse( empty, sizeof( empty ), &count ) );
+    assert( _znet_config_backup_parse( cut, sizeof( cut ), &count ) );
+    assert( _znet_config_backup_parse( header, sizeof( header ), &count ) );
+    assert( _znet_config_backup_parse( size3, sizeof( size3 ), &count ) );
+    assert( _znet_config_backup_parse( zero, sizeof( zero ), &count ) );
+    assert( _znet_config_backup_parse( none, sizeof( none ), &count ) );
+    assert( _znet_config_backup_parse( wrap, sizeof( wrap ), &count ) );
+}
+
+/// INFO: a node answering the Bulk Get in parts is asked for the rest
+static void _test_partial_report( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_param_meta_t params[4];
+    for( uint16_t i = 0; i < 4; i++ )
+        _test_meta( &params[i], 10 + i, 2 );
+    znet_param_model_t model = { .count = 4, .params = params };
+    test.model = &model;
+
+    znet_ctx_node_cmd_configuration_backup( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT );
+    assert( test.count == 1 && test.calls[0].bulk && test.calls[0].param == 10 &&
+            test.calls[0].count == 4 );
+
+    /// INFO: two values, more reports follow: nothing is asked
+    const uint8_t first[] = { 0, 1, 0, 2 };
+    znet_config_backup_values( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 10, 2, 2,
+                               first, 1, 1 );
+    assert( test.count == 1 && !test.events );
+
+    /// INFO: the last report still misses a value: the rest is asked
+    const uint8_t second[] = { 0, 3 };
+    znet_config_backup_values( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 12, 1, 2,
+                               second, 0, 1 );
+    assert( test.count == 2 && test.calls[1].bulk && test.calls[1].param == 13 &&
+            test.calls[1].count == 1 );
+
+    /// INFO: a repeated value before the expected one is skipped
+    const uint8_t third[] = { 0, 3, 0, 4 };
+    znet_config_backup_values( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 12, 2, 2,
+                               third, 0, 1 );
+    assert( test.events == 1 && test.event == ZNET_EVENT_CONFIGURATION_BACKUP &&
+            !test.err );
+
+    const znet_configuration_backup_report_t* report =
+        (const znet_configuration_backup_report_t*)test.report;
+    const uint8_t expected[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0, 10, 4, 2,
+                                 0, 1, 0, 2, 0, 3, 0, 4 };
+    assert( report->count == 4 && report->size == sizeof( expected ) );
+    assert( !memcmp( report->data, expected, sizeof( expected ) ) );
+    znet_config_backup_free( ctx );
+}
+
+/// INFO: one lost Bulk Get is repeated, no answer at all falls back to Get
+static void _test_retries( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_param_meta_t params[2];
+    _test_meta( &params[0], 1, 1 );
+    _test_meta( &params[1], 2, 1 );
+    znet_param_model_t model = { .count = 2, .params = params };
+    test.model = &model;
+
+    znet_ctx_node_cmd_configuration_backup( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT );
+    for( int i = 0; i < ZNET_CONFIG_BACKUP_RETRIES; i++ )
+    {
+        test.now += 2000;
+        znet_config_backup_proc( ctx );
+        assert( test.calls[test.count - 1].bulk );
+    }
+    assert( test.count == 1 + ZNET_CONFIG_BACKUP_RETRIES );
+
+    test.now += 2000;
+    znet_config_backup_proc( ctx );
+    assert( !test.calls[test.count - 1].bulk && test.calls[test.count - 1].param == 1 );
+    znet_config_backup_free( ctx );
+}
+
+/// INFO: differing values are merged over short gaps of equal ones
+static void _test_restore_gaps( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+
+    /// INFO: parameters 1..16 of 1 byte, the node has all zero
+    uint8_t backup[1 + ZNET_CONFIG_BACKUP_RUN_HEADER + 16];
+    memset( backup, 0, sizeof( backup ) );
+    backup[0] = ZNET_CONFIGURATION_BACKUP_FORMAT;
+    backup[2] = 1;
+    backup[3] = 16;
+    backup[4] = 1;
+    uint8_t* want = &backup[1 + ZNET_CONFIG_BACKUP_RUN_HEADER];
+    want[0] = 1;  /// INFO: 1, gap of 2, 4: merged
+    want[3] = 4;
+    want[15] = 16; /// INFO: gap of 11 is over ZNET_CONFIG_BACKUP_GAP_MAX
+
+    znet_ctx_node_cmd_configuration_restore( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                             backup, sizeof( backup ) );
+    assert( test.count == 1 && test.calls[0].bulk && !test.calls[0].set );
+
+    uint8_t have[16];
+    memset( have, 0, sizeof( have ) );
+    znet_config_backup_values( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 1, 16, 1,
+                               have, 0, 1 );
+
+    assert( test.count == 3 );
+    assert( test.calls[1].set && test.calls[1].bulk && test.calls[1].param == 1 &&
+            test.calls[1].count == 4 );
+    assert( test.calls[1].values[0] == 1 && test.calls[1].values[3] == 4 );
+    assert( test.calls[2].set && test.calls[2].param == 16 &&
+            test.calls[2].count == 1 && test.calls[2].values[0] == 16 );
+
+    const znet_configuration_restore_report_t* result =
+        (const znet_configuration_restore_report_t*)test.report;
+    assert( test.event == ZNET_EVENT_CONFIGURATION_RESTORE && !test.err );
+    assert( result->count == 16 && result->changed == 3 && result->frames == 2 );
+    znet_config_backup_free( ctx );
+}
+
+/// INFO: a rejected Set fails the restore, nothing is counted for it
+static void _test_restore_rejected( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+
+    const uint8_t backup[] = { ZNET_CONFIGURATION_BACKUP_FORMAT, 0, 1, 1, 1, 7 };
+    znet_ctx_node_cmd_configuration_restore( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                             backup, sizeof( backup ) );
+    const uint8_t have[] = { 0 };
+    test.reject_set = 1;
+    znet_config_backup_values( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 1, 1, 1,
+                               have, 0, 1 );
+
+    const znet_configuration_restore_report_t* result =
+        (const znet_configuration_restore_report_t*)test.report;
+    assert( test.event == ZNET_EVENT_CONFIGURATION_RESTORE && test.err == -1 );
+    assert( test.size && result->changed == 0 && result->frames == 0 );
+    znet_config_backup_free( ctx );
+}
+
+int main( void )
+{
+    _test_layout();
+    _test_parse();
+    _test_partial_report();
+    _test_retries();
+    _test_restore_gaps();
+    _test_restore_rejected();
+    printf( "znet_config_backup_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
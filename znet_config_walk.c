@@ -0,0 +1,392 @@
+/**
+ * @file znet_config_walk.c
+ * @date 18 Oct 2026
+ * @brief Discovery of all configuration parameters of a node.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_dispatch.h"
+#include "znet_interview.h"
+#include "znet_param_db.h"
+#include "znet_config_walk.h"
+#include "znet_mem.h"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+#define ZNET_CONFIG_WALK_META_FLAGS \
+    ( ZNET_PARAM_META_PROPERTIES | ZNET_PARAM_META_NAME | ZNET_PARAM_META_INFO )
+
+static znet_config_walk_t* _znet_config_walk_find(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id )
+{
+    for( size_t i = 0; i < ZNET_CONFIG_WALK_MAX; i++ )
+    {
+        znet_config_walk_t* walk = &ctx->walks[i];
+        if( walk->node_id == node_id && walk->channel_id == channel_id )
+            return walk;
+    }
+    return NULL;
+}
+
+static size_t _znet_config_walk_size( uint16_t count )
+{
+    return sizeof( znet_configuration_walk_report_t ) +
+           count * sizeof( znet_param_meta_t );
+}
+
+static znet_param_meta_t* _znet_config_walk_add( znet_ctx_t* ctx,
+                                                 znet_config_walk_t* walk,
+                                                 znet_cmd_configuration_id_t param_number )
+{
+    znet_configuration_walk_report_t* report = walk->report;
+
+    /// INFO: chain is ascending, search from the end
+    uint16_t pos = report->count;
+    while( pos > 0 && report->params[pos - 1].param_number >= param_number )
+    {
+        if( report->params[pos - 1].param_number == param_number )
+            return &report->params[pos - 1];
+        pos--;
+    }
+
+    if( report->count == walk->capacity )
+    {
+        uint16_t capacity = walk->capacity ? walk->capacity * 2 : 16;
+        report = (znet_configuration_walk_report_t*)znet_mem_alloc(
+            ctx, ZNET_MEM_TAG_WALK, report, _znet_config_walk_size( capacity ) );
+        if( !report )
+            return NULL;
+        walk->report = report;
+        walk->capacity = capacity;
+    }
+
+    memmove( &report->params[pos + 1], &report->params[pos],
+             ( report->count - pos ) * sizeof( znet_param_meta_t ) );
+    memset( &report->params[pos], 0, sizeof( znet_param_meta_t ) );
+    report->params[pos].param_number = param_number;
+    report->count++;
+    return &report->params[pos];
+}
+
+static znet_param_meta_t* _znet_config_walk_get( znet_config_walk_t* walk,
+                                                 znet_cmd_configuration_id_t param_number )
+{
+    znet_configuration_walk_report_t* report = walk->report;
+    for( uint16_t i = 0; i < report->count; i++ )
+        if( report->params[i].param_number == param_number )
+            return &report->params[i];
+    return NULL;
+}
+
+static void _znet_config_walk_release( znet_ctx_t* ctx, znet_config_walk_t* walk )
+{
+    znet_mem_alloc( ctx, ZNET_MEM_TAG_WALK, walk->report, 0 );
+    walk->report = NULL;
+    walk->capacity = 0;
+    walk->node_id = ZNET_NODE_ID_INVALID;
+}
+
+static void _znet_config_walk_finish( znet_ctx_t* ctx, znet_config_walk_t* walk,
+                                      int err )
+{
+    znet_node_id_t node_id = walk->node_id;
+    znet_node_channel_id_t channel_id = walk->channel_id;
+    znet_configuration_walk_report_t* report = walk->report;
+
+    for( uint16_t i = 0; i < report->count; i++ )
+        report->params[i].flags &= ZNET_CONFIG_WALK_META_FLAGS;
+
+    /// INFO: next time the parameters of this model come from the database
+    znet_param_model_t* model = znet_param_db_model( ctx, node_id );
+    if( !err && model && channel_id == ZNET_CHANNEL_ID_ROOT && !model->complete )
+    {
+        model->complete = 1;
+        znet_param_db_dirty( ctx, node_id, NULL );
+    }
+
+    /// INFO: slot is free before the callback, it may start a new discovery
+    walk->node_id = ZNET_NODE_ID_INVALID;
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_WALK, err, node_id, channel_id,
+                   report, _znet_config_walk_size( report->count ) );
+    _znet_config_walk_release( ctx, walk );
+    if( channel_id == ZNET_CHANNEL_ID_ROOT )
+        znet_interview_report( ctx, node_id, ZNET_COMMAND_CLASS_CONFIGURATION,
+                               err );
+}
+
+static uint8_t _znet_config_walk_failed_flag( uint8_t flag )
+{
+    return flag == ZNET_PARAM_META_NAME ? ZNET_CONFIG_WALK_NAME_FAILED :
+                                          ZNET_CONFIG_WALK_INFO_FAILED;
+}
+
+static void _znet_config_walk_check( znet_ctx_t* ctx, znet_config_walk_t* walk )
+{
+    if( !walk->props_pending && !walk->pending )
+        _znet_config_walk_finish( ctx, walk, 0 );
+}
+
+void znet_config_walk_init( znet_ctx_t* ctx )
+{
+    for( size_t i = 0; i < ZNET_CONFIG_WALK_MAX; i++ )
+    {
+        memset( &ctx->walks[i], 0, sizeof( znet_config_walk_t ) );
+        ctx->walks[i].node_id = ZNET_NODE_ID_INVALID;
+    }
+}
+
+void znet_config_walk_free( znet_ctx_t* ctx )
+{
+    for( size_t i = 0; i < ZNET_CONFIG_WALK_MAX; i++ )
+        if( ctx->walks[i].node_id != ZNET_NODE_ID_INVALID )
+            _znet_config_walk_release( ctx, &ctx->walks[i] );
+}
+
+void znet_config_walk_proc( znet_ctx_t* ctx )
+{
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    for( size_t i = 0; i < ZNET_CONFIG_WALK_MAX; i++ )
+    {
+        znet_config_walk_t* walk = &ctx->walks[i];
+        if( walk->node_id == ZNET_NODE_ID_INVALID ||
+            now - walk->last_time < ZNET_CONFIG_WALK_TIMEOUT_MS )
+            continue;
+
+        /// INFO: requests wait for the wake up of node
+        if( znet_ctx_node_deferred_count( ctx, walk->node_id ) )
+        {
+            walk->last_time = now;
+            continue;
+        }
+
+        ZNET_LOGW( "ZNET: Configuration discovery of node %u timed out!\n",
+                   walk->node_id );
+        _znet_config_walk_finish( ctx, walk, -1 );
+    }
+}
+
+void znet_config_walk_properties( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                  znet_node_channel_id_t channel_id,
+                                  const znet_param_meta_t* props )
+{
+    znet_config_walk_t* walk = _znet_config_walk_find( ctx, node_id, channel_id );
+    if( !walk || !walk->props_pending )
+        return;
+
+    walk->last_time = ctx->cb->clock( ctx->cb->arg );
+
+    /// INFO: size 0 - parameter is not supported, Parameter Number 0 - start
+    if( props->param_number && props->data_size )
+    {
+        znet_param_meta_t* meta = _znet_config_walk_add( ctx, walk, props->param_number );
+        if( !meta )
+        {
+            ZNET_LOGE( "ZNET: No memory for configuration discovery!\n" );
+            _znet_config_walk_finish( ctx, walk, -1 );
+            return;
+        }
+
+        meta->next_param = props->next_param;
+        meta->data_format = props->data_format;
+        meta->data_size = props->data_size;
+        meta->min_value = props->min_value;
+        meta->max_value = props->max_value;
+        meta->default_value = props->default_value;
+        meta->flags |= ZNET_PARAM_META_PROPERTIES;
+
+        /// INFO: Name and Info are pipelined with the Properties chain
+        walk->pending += 2;
+        znet_ctx_node_cmd_configuration_name_get( ctx, node_id, channel_id,
+                                                  props->param_number );
+        znet_ctx_node_cmd_configuration_info_get( ctx, node_id, channel_id,
+                                                  props->param_number );
+    }
+
+    /// INFO: end of the chain or a loop in it
+    if( props->next_param == 0 || props->next_param <= props->param_number )
+    {
+        walk->props_pending = 0;
+        _znet_config_walk_check( ctx, walk );
+        return;
+    }
+
+    /// INFO: Properties from the database come back synchronously, send the
+    /// chain in a loop instead of recursion
+    walk->next_param = props->next_param;
+    if( walk->busy )
+        return;
+
+    walk->busy = 1;
+    while( walk->next_param && walk->node_id == node_id )
+    {
+        znet_cmd_configuration_id_t next_param = walk->next_param;
+        walk->next_param = 0;
+        znet_ctx_node_cmd_configuration_properties_get( ctx, node_id, channel_id,
+                                                        next_param );
+    }
+    walk->busy = 0;
+
+    if( walk->node_id == node_id )
+        _znet_config_walk_check( ctx, walk );
+}
+
+void znet_config_walk_text( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            znet_cmd_configuration_id_t param_number,
+                            uint8_t flag, const uint8_t* data, size_t size,
+                            uint8_t rep_to_follows )
+{
+    znet_config_walk_t* walk = _znet_config_walk_find( ctx, node_id, channel_id );
+    if( !walk )
+        return;
+
+    znet_param_meta_t* meta = _znet_config_walk_get( walk, param_number );
+    if( !meta || ( meta->flags & ( flag | _znet_config_walk_failed_flag( flag ) ) ) )
+        return;
+
+    walk->last_time = ctx->cb->clock( ctx->cb->arg );
+
+    uint8_t partial = ( flag == ZNET_PARAM_META_NAME ) ?
+        ZNET_PARAM_META_NAME_PARTIAL : ZNET_PARAM_META_INFO_PARTIAL;
+    if( flag == ZNET_PARAM_META_NAME )
+        znet_param_db_text( meta->name, sizeof( meta->name ), data, size,
+                            !( meta->flags & partial ) );
+    else
+        znet_param_db_text( meta->info, sizeof( meta->info ), data, size,
+                            !( meta->flags & partial ) );
+
+    if( rep_to_follows )
+    {
+        meta->flags |= partial;
+        return;
+    }
+
+    meta->flags = ( meta->flags & ~partial ) | flag;
+    walk->pending--;
+    if( !walk->busy )
+        _znet_config_walk_check( ctx, walk );
+}
+
+void znet_config_walk_failed( znet_ctx_t* ctx, znet_node_id_t node_id,
+                              znet_node_channel_id_t channel_id,
+                              znet_cmd_configuration_id_t param_number,
+                              uint8_t flag )
+{
+    znet_config_walk_t* walk = _znet_config_walk_find( ctx, node_id, channel_id );
+    if( !walk )
+        return;
+
+    /// INFO: the chain can not go on
+    if( flag == ZNET_PARAM_META_PROPERTIES )
+    {
+        if( !walk->props_pending )
+            return;
+        ZNET_LOGW( "ZNET: Properties Get %u of node %u failed!\n",
+                   param_number, node_id );
+        _znet_config_walk_finish( ctx, walk, -1 );
+        return;
+    }
+
+    /// INFO: counted once, a late report of it is ignored
+    znet_param_meta_t* meta = _znet_config_walk_get( walk, param_number );
+    uint8_t failed = _znet_config_walk_failed_flag( flag );
+    if( !meta || ( meta->flags & ( flag | failed ) ) )
+        return;
+
+    meta->flags |= failed;
+    walk->pending--;
+    if( !walk->busy )
+        _znet_config_walk_check( ctx, walk );
+}
+
+void znet_ctx_node_cmd_configuration_walk( znet_ctx_t* ctx,
+                                           znet_node_id_t node_id,
+                                           znet_node_channel_id_t channel_id )
+{
+    if( !ctx )
+    {
+        ZNET_LOGE( "ZNET: Library not initialized!\n" );
+        return;
+    }
+
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX ||
+        _znet_config_walk_find( ctx, node_id, channel_id ) )
+    {
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_WALK,
+                       -1, node_id, channel_id, NULL, 0 );
+        if( channel_id == ZNET_CHANNEL_ID_ROOT )
+            znet_interview_report( ctx, node_id,
+                                   ZNET_COMMAND_CLASS_CONFIGURATION, -1 );
+        return;
+    }
+
+    znet_config_walk_t* walk = NULL;
+    for( size_t i = 0; !walk && i < ZNET_CONFIG_WALK_MAX; i++ )
+        if( ctx->walks[i].node_id == ZNET_NODE_ID_INVALID )
+            walk = &ctx->walks[i];
+
+    uint16_t capacity = 16;
+    const znet_param_model_t* model = znet_param_db_model( ctx, node_id );
+    if( model && model->count > capacity )
+        capacity = model->count;
+#if ZNET_CFG_STATIC_MEMORY
+    /// INFO: the block is never grown
+    capacity = ZNET_CFG_STATIC_WALK_PARAMS;
+#endif
+
+    znet_configuration_walk_report_t* report = NULL;
+    if( walk )
+        report = (znet_configuration_walk_report_t*)znet_mem_alloc(
+            ctx, ZNET_MEM_TAG_WALK, NULL, _znet_config_walk_size( capacity ) );
+    if( !report )
+    {
+        ZNET_LOGE( "ZNET: Configuration discovery is not started!\n" );
+        znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_WALK,
+                       -1, node_id, channel_id, NULL, 0 );
+        if( channel_id == ZNET_CHANNEL_ID_ROOT )
+            znet_interview_report( ctx, node_id,
+                                   ZNET_COMMAND_CLASS_CONFIGURATION, -1 );
+        return;
+    }
+
+    memset( report, 0, sizeof( znet_configuration_walk_report_t ) );
+    walk->node_id = node_id;
+    walk->channel_id = channel_id;
+    walk->report = report;
+    walk->capacity = capacity;
+    walk->pending = 0;
+    walk->busy = 0;
+    walk->next_param = 0;
+    walk->last_time = ctx->cb->clock( ctx->cb->arg );
+
+    /// INFO: model is already discovered, no radio traffic at all
+    if( model && model->complete && channel_id == ZNET_CHANNEL_ID_ROOT )
+    {
+        for( uint16_t i = 0; i < model->count; i++ )
+            if( model->params[i].param_number && model->params[i].data_size )
+                report->params[report->count++] = model->params[i];
+        _znet_config_walk_finish( ctx, walk, 0 );
+        return;
+    }
+
+    /// INFO: Parameter Number 0 reports the first parameter as next
+    walk->props_pending = 1;
+    znet_ctx_node_cmd_configuration_properties_get( ctx, node_id, channel_id, 0 );
+}
+
+void znet_node_cmd_configuration_walk( znet_node_id_t node_id,
+                                       znet_node_channel_id_t channel_id )
+{
+    znet_ctx_node_cmd_configuration_walk( znet_ctx_default, node_id, channel_id );
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
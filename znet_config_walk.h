@@ -0,0 +1,104 @@
+/**
+ * @file znet_config_walk.h
+ * @date 18 Oct 2026
+ * @brief Discovery of all configuration parameters of a node.
+ */
+
+#ifndef ZNET_CONFIG_WALK_H
+#define ZNET_CONFIG_WALK_H
+
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max number of nodes discovered at the same time
+ */
+#define ZNET_CONFIG_WALK_MAX 4
+
+/**
+ * @brief Time without reports after which discovery fails (ms)
+ */
+#define ZNET_CONFIG_WALK_TIMEOUT_MS 30000
+
+/**
+ * @brief Name/Info request of parameter failed, it is not waited for
+ */
+#define ZNET_CONFIG_WALK_NAME_FAILED 0x40
+#define ZNET_CONFIG_WALK_INFO_FAILED 0x80
+
+/**
+ * @brief Discovery of one node
+ *
+ * Properties Get follows the Next Parameter Number chain, Name Get and Info Get
+ * of every found parameter are sent without waiting for the chain.
+ */
+typedef struct znet_config_walk_t
+{
+    znet_node_id_t node_id;            /**< Node ID, INVALID - free slot */
+    znet_node_channel_id_t channel_id; /**< Channel ID */
+    uint8_t props_pending;             /**< flag: Properties Get outstanding */
+    uint8_t busy;                      /**< flag: sending Properties Get */
+    znet_cmd_configuration_id_t next_param; /**< Properties Get to send */
+    uint16_t pending;                  /**< Name/Info Get outstanding */
+    uint16_t capacity;                 /**< Capacity of report */
+    uint64_t last_time;                /**< Time of last report (ms) */
+    znet_configuration_walk_report_t* report; /**< Found parameters */
+} znet_config_walk_t;
+
+/**
+ * @brief Init discovery state
+ */
+void znet_config_walk_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Abort all discoveries and release memory
+ */
+void znet_config_walk_free( znet_ctx_t* ctx );
+
+/**
+ * @brief Fail discoveries without reports for ZNET_CONFIG_WALK_TIMEOUT_MS
+ */
+void znet_config_walk_proc( znet_ctx_t* ctx );
+
+/**
+ * @brief Feed Properties Report to the discovery of node
+ */
+void znet_config_walk_properties( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                  znet_node_channel_id_t channel_id,
+                                  const znet_param_meta_t* props );
+
+/**
+ * @brief Feed Name/Info Report to the discovery of node
+ *
+ * @param flag ZNET_PARAM_META_NAME or ZNET_PARAM_META_INFO
+ */
+void znet_config_walk_text( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            znet_cmd_configuration_id_t param_number,
+                            uint8_t flag, const uint8_t* data, size_t size,
+                            uint8_t rep_to_follows );
+
+/**
+ * @brief Request of the discovery of node failed (rejected or not sent)
+ *
+ * A failed Properties Get ends the discovery with an error, a failed Name/Info
+ * Get leaves the text of the parameter empty.
+ *
+ * @param flag ZNET_PARAM_META_PROPERTIES, ZNET_PARAM_META_NAME or
+ * ZNET_PARAM_META_INFO
+ */
+void znet_config_walk_failed( znet_ctx_t* ctx, znet_node_id_t node_id,
+                              znet_node_channel_id_t channel_id,
+                              znet_cmd_configuration_id_t param_number,
+                              uint8_t flag );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_CONFIG_WALK_H
@@ -0,0 +1,279 @@
+/**
+ * @file znet_config_walk_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of discovery of configuration parameters.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_config_walk_test.c -o znet_config_walk_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_config_walk.c"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+#define TEST_NODE 5
+
+static struct
+{
+    uint64_t now;
+    size_t held;                /**< Commands held for TEST_NODE */
+    int props_get;              /**< Parameter of Properties Get, -1 - none */
+    size_t text_gets;           /**< Name and Info Gets */
+    size_t live;                /**< Blocks not released */
+    size_t results;             /**< Walk results */
+    int err;                    /**< Error of last result */
+    uint16_t count;             /**< Parameters of last result */
+    znet_param_meta_t params[4]; /**< Parameters of last result */
+    size_t interviews;          /**< Interview reports */
+} test;
+
+znet_ctx_t* znet_ctx_default = NULL;
+
+void znet_dispatch( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+                    const void* value, size_t size )
+{
+    (void)ctx;
+    (void)channel_id;
+    (void)size;
+    assert( type == ZNET_EVENT_CONFIGURATION_WALK && node_id == TEST_NODE );
+    const znet_configuration_walk_report_t* report = value;
+    test.results++;
+    test.err = err;
+    test.count = report ? report->count : 0;
+    for( uint16_t i = 0; i < test.count && i < 4; i++ )
+        test.params[i] = report->params[i];
+}
+
+void znet_interview_report( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_command_class_t command, int err )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)command;
+    assert( err == test.err );
+    test.interviews++;
+}
+
+znet_param_model_t* znet_param_db_model( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+    return NULL;
+}
+
+void znet_param_db_dirty( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          const znet_param_meta_t* meta )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)meta;
+}
+
+void znet_param_db_text( char* text, size_t text_size, const uint8_t* data,
+                         size_t size, int first )
+{
+    size_t used = first ? 0 : strlen( text );
+    if( size > text_size - 1 - used )
+        size = text_size - 1 - used;
+    memcpy( &text[used], data, size );
+    text[used + size] = 0;
+}
+
+void* znet_mem_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag, void* ptr, size_t size )
+{
+    (void)ctx;
+    assert( tag == ZNET_MEM_TAG_WALK );
+    if( !size )
+    {
+        if( ptr )
+            test.live--;
+        free( ptr );
+        return NULL;
+    }
+    if( !ptr )
+        test.live++;
+    return realloc( ptr, size );
+}
+
+size_t znet_ctx_node_deferred_count( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+    return test.held;
+}
+
+void znet_ctx_node_cmd_configuration_properties_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    assert( test.props_get == -1 );
+    test.props_get = param_number;
+}
+
+void znet_ctx_node_cmd_configuration_name_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    (void)param_number;
+    test.text_gets++;
+}
+
+void znet_ctx_node_cmd_configuration_info_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    (void)param_number;
+    test.text_gets++;
+}
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return test.now;
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_config_walk_init( &_test_ctx );
+    test.now = 1000000;
+    test.props_get = -1;
+
+    znet_ctx_node_cmd_configuration_walk( &_test_ctx, TEST_NODE,
+                                          ZNET_CHANNEL_ID_ROOT );
+    assert( test.props_get == 0 && test.live == 1 );
+    return &_test_ctx;
+}
+
+/// INFO: answer the outstanding Properties Get
+static void _test_props( znet_ctx_t* ctx, uint16_t param, uint16_t next )
+{
+    assert( test.props_get == param );
+    test.props_get = -1;
+    znet_param_meta_t props = { .param_number = param, .next_param = next,
+                                .data_size = param ? 1 : 0 };
+    znet_config_walk_properties( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, &props );
+}
+
+static void _test_text( znet_ctx_t* ctx, uint16_t param, uint8_t flag,
+                        const char* text, uint8_t rep_to_follows )
+{
+    znet_config_walk_text( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, param, flag,
+                           (const uint8_t*)text, strlen( text ),
+                           rep_to_follows );
+}
+
+/// INFO: the Properties chain is followed, Name and Info go along with it
+static void _test_chain( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    _test_props( ctx, 0, 1 );
+    _test_props( ctx, 1, 3 );
+    _test_props( ctx, 3, 0 );
+    assert( test.props_get == -1 && test.text_gets == 4 && !test.results );
+
+    _test_text( ctx, 1, ZNET_PARAM_META_NAME, "Led ", 1 );
+    _test_text( ctx, 1, ZNET_PARAM_META_NAME, "mode", 0 );
+    _test_text( ctx, 1, ZNET_PARAM_META_INFO, "0 - off", 0 );
+    _test_text( ctx, 3, ZNET_PARAM_META_NAME, "Delay", 0 );
+
+    /// INFO: a failed Info leaves the text empty, counted once
+    znet_config_walk_failed( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 3,
+                             ZNET_PARAM_META_INFO );
+    assert( test.results == 1 && !test.err && test.interviews == 1 );
+    assert( test.count == 2 && test.live == 0 );
+    assert( test.params[0].param_number == 1 && test.params[1].param_number == 3 );
+    assert( !strcmp( test.params[0].name, "Led mode" ) );
+    assert( !strcmp( test.params[0].info, "0 - off" ) );
+    assert( test.params[1].flags ==
+            ( ZNET_PARAM_META_PROPERTIES | ZNET_PARAM_META_NAME ) );
+
+    /// INFO: late reports of the finished discovery are ignored
+    znet_config_walk_failed( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 3,
+                             ZNET_PARAM_META_INFO );
+    _test_text( ctx, 3, ZNET_PARAM_META_INFO, "late", 0 );
+    assert( test.results == 1 );
+}
+
+/// INFO: a chain pointing back ends the discovery
+static void _test_loop( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    _test_props( ctx, 0, 2 );
+    _test_props( ctx, 2, 2 );
+    _test_text( ctx, 2, ZNET_PARAM_META_NAME, "A", 0 );
+    _test_text( ctx, 2, ZNET_PARAM_META_INFO, "B", 0 );
+    assert( test.results == 1 && !test.err && test.count == 1 );
+}
+
+/// INFO: a failed Properties Get ends the discovery with an error
+static void _test_failed( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    _test_props( ctx, 0, 1 );
+    test.err = -1;
+    znet_config_walk_failed( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 1,
+                             ZNET_PARAM_META_PROPERTIES );
+    assert( test.results == 1 && test.err == -1 && test.live == 0 );
+}
+
+/// INFO: no timeout while requests wait for the wake up of node
+static void _test_timeout( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    test.held = 1;
+    test.now += 2 * ZNET_CONFIG_WALK_TIMEOUT_MS;
+    znet_config_walk_proc( ctx );
+    assert( test.results == 0 );
+
+    test.held = 0;
+    test.now += ZNET_CONFIG_WALK_TIMEOUT_MS - 1;
+    znet_config_walk_proc( ctx );
+    assert( test.results == 0 );
+
+    test.err = -1;
+    test.now++;
+    znet_config_walk_proc( ctx );
+    assert( test.results == 1 && test.err == -1 && test.live == 0 );
+}
+
+int main( void )
+{
+    _test_chain();
+    _test_loop();
+    _test_failed();
+    _test_timeout();
+    printf( "znet_config_walk_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
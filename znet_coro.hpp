@@ -0,0 +1,555 @@
+/**
+ * @file znet_coro.hpp
+ * @date 18 Oct 2026
+ * @brief C++20 coroutines over the requests of znet context.
+ *
+ * Header only. A request is an awaitable living in the coroutine frame: no
+ * allocation per await. The Executor is driven by the thread of znet_proc and
+ * resumes coroutines from it, with the report or with an error or timeout.
+ *
+ * Example of use:
+ * @code
+ * znet::Task interview( znet::Executor& exec, znet_node_id_t node_id )
+ * {
+ *     auto props = co_await znet::configuration_properties_get( exec, node_id,
+ *                                                                ZNET_CHANNEL_ID_ROOT, 1 );
+ *     while( !props.err && props->next_param )
+ *     {
+ *         auto value = co_await znet::configuration_get( exec, node_id,
+ *             ZNET_CHANNEL_ID_ROOT, (uint8_t)props->param_number );
+ *         ...
+ *         props = co_await znet::configuration_properties_get( exec, node_id,
+ *             ZNET_CHANNEL_ID_ROOT, props->next_param );
+ *     }
+ * }
+ *
+ * znet::Executor exec( ctx );
+ * interview( exec, 5 );
+ * for(;;) {
+ *     exec.proc();
+ *     usleep(1000);
+ * }
+ * @endcode
+ */
+
+#ifndef ZNET_CORO_HPP
+#define ZNET_CORO_HPP
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <utility>
+
+#include <znet/znet.h>
+
+namespace znet
+{
+
+/**
+ * @brief Results of await besides the err of report
+ */
+constexpr int ERR_TIMEOUT = -2;   /**< No report within the timeout */
+constexpr int ERR_CANCELLED = -3; /**< Executor destroyed */
+constexpr int ERR_TOO_BIG = -4;   /**< Report over the capacity of request */
+
+/**
+ * @brief Default timeout of request
+ *
+ * GETs lost in the network also fail by the round-trip timeout of the library,
+ * this one bounds the whole wait. The library tracks 16 different
+ * Configuration Gets at a time, more awaited at once fail with err -1.
+ */
+constexpr std::chrono::milliseconds TIMEOUT_DEFAULT{ 30000 };
+
+/**
+ * @brief Fire-and-forget coroutine, started at once, frame released at end
+ */
+struct Task
+{
+    struct promise_type
+    {
+        Task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+class Executor;
+
+/**
+ * @brief Request waiting for its report, intrusive list entry of Executor
+ */
+struct Pending
+{
+    Pending* prev = nullptr;
+    Pending* next = nullptr;
+
+    znet_node_id_t node_id = ZNET_NODE_ID_INVALID;
+    znet_node_channel_id_t channel_id = ZNET_CHANNEL_ID_ROOT;
+    znet_command_class_t command_class = 0;
+    uint8_t command = 0;
+
+    /// INFO: optional match of report value, e.g. by Parameter Number
+    bool ( *match )( const Pending& pending, const void* value ) = nullptr;
+    uint32_t key = 0;
+
+    std::chrono::steady_clock::time_point deadline;
+    std::coroutine_handle<> handle;
+    uint32_t seq = 0; /**< Order of link, errors go to the oldest request */
+
+    int err = 0;
+    size_t size = 0;
+    void* storage = nullptr;
+    size_t capacity = 0;
+};
+
+/**
+ * @brief Resumes coroutines of a context on reports and timeouts
+ *
+ * Owns one subscription of the context. Pending requests are kept in lists
+ * by node, so a report visits the requests of its node only. Use from the
+ * thread of znet_proc.
+ */
+class Executor
+{
+public:
+    explicit Executor( znet_ctx_t* ctx ) : ctx_( ctx )
+    {
+        znet_report_filter_t filter{};
+        filter.channel_id = ZNET_REPORT_ANY_CHANNEL;
+        handle_ = znet_ctx_subscribe( ctx_, &filter, &Executor::on_report, this );
+    }
+
+    ~Executor()
+    {
+        if( handle_ > 0 )
+            znet_ctx_unsubscribe( ctx_, handle_ );
+        handle_ = -1;
+
+        /// INFO: frames waiting here are resumed once with an error, requests
+        /// they make meanwhile fail at once (no subscription)
+        Pending* ready = nullptr;
+        for( auto& head : nodes_ )
+            while( head )
+            {
+                Pending* it = head;
+                unlink( it );
+                it->err = ERR_CANCELLED;
+                it->size = 0;
+                it->next = ready;
+                ready = it;
+            }
+        resume( ready );
+    }
+
+    Executor( const Executor& ) = delete;
+    Executor& operator=( const Executor& ) = delete;
+
+    /**
+     * @brief Subscription of the context is taken
+     */
+    bool valid() const noexcept { return handle_ > 0; }
+
+    znet_ctx_t* ctx() const noexcept { return ctx_; }
+
+    /**
+     * @brief Number of requests waiting
+     */
+    size_t pending() const noexcept { return count_; }
+
+    /**
+     * @brief Run znet_ctx_proc and fail expired requests
+     */
+    void proc()
+    {
+        znet_ctx_proc( ctx_ );
+        expire( std::chrono::steady_clock::now() );
+    }
+
+    /**
+     * @brief Start to wait for report, called by awaitables
+     */
+    void link( Pending* it ) noexcept
+    {
+        Pending*& head = nodes_[index( it->node_id )];
+        it->prev = nullptr;
+        it->next = head;
+        it->seq = ++seq_;
+        if( head )
+            head->prev = it;
+        head = it;
+        count_++;
+        if( count_ == 1 || it->deadline < next_deadline_ )
+            next_deadline_ = it->deadline;
+    }
+
+    void unlink( Pending* it ) noexcept
+    {
+        Pending*& head = nodes_[index( it->node_id )];
+        if( it->prev )
+            it->prev->next = it->next;
+        else
+            head = it->next;
+        if( it->next )
+            it->next->prev = it->prev;
+        it->prev = it->next = nullptr;
+        count_--;
+    }
+
+private:
+    static size_t index( znet_node_id_t node_id ) noexcept
+    {
+        return node_id <= ZNET_NODE_ID_MAX ? node_id : 0;
+    }
+
+    static void on_report( const znet_report_t* report, void* arg )
+    {
+        static_cast<Executor*>( arg )->deliver( *report );
+    }
+
+    static void resume( Pending* ready )
+    {
+        while( ready )
+        {
+            Pending* next = ready->next;
+            ready->next = nullptr;
+            ready->handle.resume();
+            ready = next;
+        }
+    }
+
+    bool same_command( const Pending& it, const znet_report_t& report ) const noexcept
+    {
+        return it.channel_id == report.channel_id &&
+               it.command_class == report.command_class &&
+               it.command == report.command;
+    }
+
+    /// INFO: an error without value to match the key fails the oldest request
+    /// of its command; a node unknown to the library (INVALID) is looked up in
+    /// all nodes. Errors of Configuration requests carry their key.
+    void fail( const znet_report_t& report )
+    {
+        Pending* oldest = nullptr;
+        size_t first = report.node_id <= ZNET_NODE_ID_MAX ? report.node_id : 0;
+        size_t last = report.node_id <= ZNET_NODE_ID_MAX ? report.node_id : ZNET_NODE_ID_MAX;
+        for( size_t i = first; i <= last; i++ )
+            for( Pending* it = nodes_[i]; it; it = it->next )
+                if( same_command( *it, report ) &&
+                    ( !oldest || (int32_t)( it->seq - oldest->seq ) < 0 ) )
+                    oldest = it;
+        if( !oldest )
+            return;
+
+        unlink( oldest );
+        oldest->err = report.err;
+        oldest->size = 0;
+        oldest->handle.resume();
+    }
+
+    void deliver( const znet_report_t& report )
+    {
+        if( report.err && !report.value )
+        {
+            fail( report );
+            return;
+        }
+        if( report.node_id > ZNET_NODE_ID_MAX )
+            return;
+
+        /// INFO: detach all matches first, resumed coroutines may link again
+        Pending* ready = nullptr;
+        Pending* it = nodes_[report.node_id];
+        while( it )
+        {
+            Pending* next = it->next;
+            if( same_command( *it, report ) &&
+                ( !it->match || ( report.value && it->match( *it, report.value ) ) ) )
+            {
+                unlink( it );
+                it->err = report.err;
+                it->size = report.size;
+                if( report.size > it->capacity )
+                    it->err = ERR_TOO_BIG;
+                else if( report.size )
+                    std::memcpy( it->storage, report.value, report.size );
+                it->next = ready;
+                ready = it;
+            }
+            it = next;
+        }
+
+        resume( ready );
+    }
+
+    void expire( std::chrono::steady_clock::time_point now )
+    {
+        if( !count_ || now < next_deadline_ )
+            return;
+
+        Pending* ready = nullptr;
+        auto next_deadline = std::chrono::steady_clock::time_point::max();
+        for( auto& head : nodes_ )
+        {
+            Pending* it = head;
+            while( it )
+            {
+                Pending* next = it->next;
+                if( it->deadline <= now )
+                {
+                    unlink( it );
+                    it->err = ERR_TIMEOUT;
+                    it->size = 0;
+                    it->next = ready;
+                    ready = it;
+                }
+                else if( it->deadline < next_deadline )
+                    next_deadline = it->deadline;
+                it = next;
+            }
+        }
+        next_deadline_ = next_deadline;
+
+        resume( ready );
+    }
+
+    znet_ctx_t* ctx_;
+    int handle_ = -1;
+    size_t count_ = 0;
+    uint32_t seq_ = 0;
+    std::chrono::steady_clock::time_point next_deadline_;
+    Pending* nodes_[ZNET_NODE_ID_MAX + 1] = {};
+};
+
+/**
+ * @brief Result of await: err and the report copied into the frame
+ */
+template <class T, size_t Capacity = sizeof( T )>
+struct Reply
+{
+    int err = 0;     /**< Zero on success, err of report or ERR_* */
+    size_t size = 0; /**< Size of report, 0 - no report */
+    alignas( T ) std::byte storage[Capacity];
+
+    explicit operator bool() const noexcept { return !err && size; }
+    const T* get() const noexcept
+    {
+        return size ? reinterpret_cast<const T*>( storage ) : nullptr;
+    }
+    const T* operator->() const noexcept { return get(); }
+    const T& operator*() const noexcept { return *get(); }
+};
+
+/**
+ * @brief Awaitable request: sends on suspend, resumes with Reply
+ *
+ * @tparam T Report type of the callback in znet_callbacks_t
+ * @tparam Send Callable sending the request: void( znet_ctx_t* )
+ * @tparam Capacity Room for report with its flexible array
+ */
+template <class T, class Send, size_t Capacity = sizeof( T )>
+class Request
+{
+public:
+    Request( Executor& exec, znet_node_id_t node_id,
+             znet_node_channel_id_t channel_id, znet_command_class_t command_class,
+             uint8_t command, Send send, std::chrono::milliseconds timeout )
+        : exec_( exec ), send_( std::move( send ) ), timeout_( timeout )
+    {
+        pending_.node_id = node_id;
+        pending_.channel_id = channel_id;
+        pending_.command_class = command_class;
+        pending_.command = command;
+    }
+
+    /**
+     * @brief Match reports by value, e.g. by Parameter Number
+     */
+    Request& match( bool ( *fn )( const Pending&, const void* ), uint32_t key ) noexcept
+    {
+        pending_.match = fn;
+        pending_.key = key;
+        return *this;
+    }
+
+    bool await_ready() const noexcept
+    {
+        return !exec_.valid() || pending_.node_id < ZNET_NODE_ID_MIN ||
+               pending_.node_id > ZNET_NODE_ID_MAX;
+    }
+
+    void await_suspend( std::coroutine_handle<> handle )
+    {
+        pending_.handle = handle;
+        pending_.storage = reply_.storage;
+        pending_.capacity = Capacity;
+        pending_.deadline = std::chrono::steady_clock::now() + timeout_;
+
+        /// INFO: link before send, the report may arrive inline
+        exec_.link( &pending_ );
+        send_( exec_.ctx() );
+    }
+
+    Reply<T, Capacity> await_resume() noexcept
+    {
+        if( !pending_.handle )
+            reply_.err = -1;
+        else
+        {
+            reply_.err = pending_.err;
+            reply_.size = pending_.err == ERR_TOO_BIG ? 0 : pending_.size;
+        }
+        return reply_;
+    }
+
+private:
+    Executor& exec_;
+    Send send_;
+    std::chrono::milliseconds timeout_;
+    Pending pending_;
+    Reply<T, Capacity> reply_;
+};
+
+/**
+ * @brief Await any report of node, the request is sent by send
+ */
+template <class T, size_t Capacity = sizeof( T ), class Send>
+Request<T, Send, Capacity> request( Executor& exec, znet_node_id_t node_id,
+                                    znet_node_channel_id_t channel_id,
+                                    znet_command_class_t command_class,
+                                    uint8_t command, Send send,
+                                    std::chrono::milliseconds timeout = TIMEOUT_DEFAULT )
+{
+    return Request<T, Send, Capacity>( exec, node_id, channel_id, command_class,
+                                       command, std::move( send ), timeout );
+}
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+/// INFO: Configuration Command Class reports
+constexpr uint8_t CONFIGURATION_REPORT = 0x06;
+constexpr uint8_t CONFIGURATION_BULK_REPORT = 0x09;
+constexpr uint8_t CONFIGURATION_NAME_REPORT = 0x0B;
+constexpr uint8_t CONFIGURATION_INFO_REPORT = 0x0D;
+constexpr uint8_t CONFIGURATION_PROPERTIES_REPORT = 0x0F;
+
+/// INFO: room for text of Name/Info report and for values of Bulk Report
+constexpr size_t CONFIGURATION_TEXT_MAX = 64;
+constexpr size_t CONFIGURATION_BULK_MAX = 255 * 4;
+
+template <class T>
+bool match_param( const Pending& pending, const void* value )
+{
+    return static_cast<const T*>( value )->param_number == pending.key;
+}
+
+inline bool match_offset( const Pending& pending, const void* value )
+{
+    return static_cast<const znet_configuration_bulk_report_t*>( value )
+               ->param_offset == pending.key;
+}
+
+inline auto configuration_get( Executor& exec, znet_node_id_t node_id,
+                               znet_node_channel_id_t channel_id,
+                               uint8_t param_number,
+                               std::chrono::milliseconds timeout = TIMEOUT_DEFAULT )
+{
+    auto send = [=]( znet_ctx_t* ctx ) {
+        znet_ctx_node_cmd_configuration_get( ctx, node_id, channel_id, param_number );
+    };
+    auto req = request<znet_configuration_report_t>(
+        exec, node_id, channel_id, ZNET_COMMAND_CLASS_CONFIGURATION,
+        CONFIGURATION_REPORT, send, timeout );
+    req.match( &match_param<znet_configuration_report_t>, param_number );
+    return req;
+}
+
+/**
+ * @brief Await the first Bulk Report, reports to follow come to the callback
+ */
+inline auto configuration_bulk_get( Executor& exec, znet_node_id_t node_id,
+                                    znet_node_channel_id_t channel_id,
+                                    znet_cmd_configuration_id_t param_offset,
+                                    uint8_t count,
+                                    std::chrono::milliseconds timeout = TIMEOUT_DEFAULT )
+{
+    auto send = [=]( znet_ctx_t* ctx ) {
+        znet_ctx_node_cmd_configuration_bulk_get( ctx, node_id, channel_id,
+                                                  param_offset, count );
+    };
+    auto req = request<znet_configuration_bulk_report_t,
+                       sizeof( znet_configuration_bulk_report_t ) + CONFIGURATION_BULK_MAX>(
+        exec, node_id, channel_id, ZNET_COMMAND_CLASS_CONFIGURATION,
+        CONFIGURATION_BULK_REPORT, send, timeout );
+    req.match( &match_offset, param_offset );
+    return req;
+}
+
+/**
+ * @brief Await the first Name Report, see rep_to_follows
+ */
+inline auto configuration_name_get( Executor& exec, znet_node_id_t node_id,
+                                    znet_node_channel_id_t channel_id,
+                                    znet_cmd_configuration_id_t param_number,
+                                    std::chrono::milliseconds timeout = TIMEOUT_DEFAULT )
+{
+    auto send = [=]( znet_ctx_t* ctx ) {
+        znet_ctx_node_cmd_configuration_name_get( ctx, node_id, channel_id,
+                                                  param_number );
+    };
+    auto req = request<znet_configuration_name_report_t,
+                       sizeof( znet_configuration_name_report_t ) + CONFIGURATION_TEXT_MAX>(
+        exec, node_id, channel_id, ZNET_COMMAND_CLASS_CONFIGURATION,
+        CONFIGURATION_NAME_REPORT, send, timeout );
+    req.match( &match_param<znet_configuration_name_report_t>, param_number );
+    return req;
+}
+
+/**
+ * @brief Await the first Info Report, see rep_to_follows
+ */
+inline auto configuration_info_get( Executor& exec, znet_node_id_t node_id,
+                                    znet_node_channel_id_t channel_id,
+                                    znet_cmd_configuration_id_t param_number,
+                                    std::chrono::milliseconds timeout = TIMEOUT_DEFAULT )
+{
+    auto send = [=]( znet_ctx_t* ctx ) {
+        znet_ctx_node_cmd_configuration_info_get( ctx, node_id, channel_id,
+                                                  param_number );
+    };
+    auto req = request<znet_configuration_info_report_t,
+                       sizeof( znet_configuration_info_report_t ) + CONFIGURATION_TEXT_MAX>(
+        exec, node_id, channel_id, ZNET_COMMAND_CLASS_CONFIGURATION,
+        CONFIGURATION_INFO_REPORT, send, timeout );
+    req.match( &match_param<znet_configuration_info_report_t>, param_number );
+    return req;
+}
+
+inline auto configuration_properties_get( Executor& exec, znet_node_id_t node_id,
+                                          znet_node_channel_id_t channel_id,
+                                          znet_cmd_configuration_id_t param_number,
+                                          std::chrono::milliseconds timeout = TIMEOUT_DEFAULT )
+{
+    auto send = [=]( znet_ctx_t* ctx ) {
+        znet_ctx_node_cmd_configuration_properties_get( ctx, node_id, channel_id,
+                                                        param_number );
+    };
+    /// INFO: Properties1, 3 values of 4 bytes, Next Parameter Number
+    auto req = request<znet_configuration_properties_report_t,
+                       sizeof( znet_configuration_properties_report_t ) + 16>(
+        exec, node_id, channel_id, ZNET_COMMAND_CLASS_CONFIGURATION,
+        CONFIGURATION_PROPERTIES_REPORT, send, timeout );
+    req.match( &match_param<znet_configuration_properties_report_t>, param_number );
+    return req;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
+
+}  // namespace znet
+
+#endif  // ZNET_CORO_HPP
@@ -0,0 +1,113 @@
+/**
+ * @file znet_ctx.c
+ * @date 18 Oct 2026
+ * @brief Library context: all state of one controller.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+
+znet_ctx_t* znet_ctx_default = NULL;
+
+znet_ctx_t* znet_ctx_init( const znet_callbacks_t* callbacks )
+{
+    if( !callbacks || !callbacks->clock )
+        return NULL;
+    if( !ZNET_CFG_STATIC_MEMORY && !callbacks->alloc )
+        return NULL;
+
+    znet_ctx_t* ctx = znet_mem_ctx_alloc( callbacks );
+    if( !ctx )
+        return NULL;
+
+    memset( ctx, 0, sizeof( znet_ctx_t ) );
+    ctx->cb = callbacks;
+    znet_mem_init( ctx );
+    for( size_t i = 0; i < ZNET_INFLIGHT_MAX; i++ )
+        ctx->inflight[i].node_id = ZNET_NODE_ID_INVALID;
+    znet_uart_init( ctx );
+    znet_dispatch_init( ctx );
+    znet_subscribe_init( ctx );
+#if ZNET_CFG_CC_CONFIGURATION
+    znet_config_walk_init( ctx );
+    znet_config_backup_init( ctx );
+#endif
+    znet_deferred_init( ctx );
+    znet_rtt_init( ctx );
+    znet_airtime_init( ctx );
+    znet_health_init( ctx );
+    znet_interview_init( ctx );
+    znet_persist_init( ctx );
+    znet_state_init( ctx );
+#if ZNET_CFG_CC_METER
+    znet_meter_series_init( ctx );
+#endif
+
+    if( znet_main_init( ctx ) )
+    {
+        znet_mem_ctx_free( ctx );
+        return NULL;
+    }
+
+#if ZNET_CFG_CC_CONFIGURATION
+    znet_param_db_init( ctx );
+#endif
+
+    return ctx;
+}
+
+znet_ctx_t* znet_ctx_get_default( void )
+{
+    return znet_ctx_default;
+}
+
+void znet_ctx_proc( znet_ctx_t* ctx )
+{
+    assert( ctx );
+
+    if( znet_uart_flush( ctx ) )
+        ZNET_LOGE( "ZNET: Uart write failed!\n" );
+
+    znet_main_proc( ctx );
+    znet_inflight_proc( ctx );
+    znet_dispatch_proc( ctx );
+    znet_deferred_proc( ctx );
+    znet_health_proc( ctx );
+#if ZNET_CFG_CC_CONFIGURATION
+    znet_config_walk_proc( ctx );
+    znet_config_backup_proc( ctx );
+#endif
+    znet_interview_proc( ctx );
+    znet_persist_proc( ctx );
+}
+
+void znet_ctx_free( znet_ctx_t* ctx )
+{
+    if( !ctx )
+        return;
+
+    znet_main_free( ctx );
+    znet_persist_free( ctx );
+    znet_dispatch_free( ctx );
+#if ZNET_CFG_CC_CONFIGURATION
+    znet_config_walk_free( ctx );
+    znet_config_backup_free( ctx );
+    znet_param_db_free( ctx );
+#endif
+#if ZNET_CFG_CC_METER
+    znet_meter_series_free( ctx );
+#endif
+
+    if( ctx == znet_ctx_default )
+        znet_ctx_default = NULL;
+
+    znet_mem_ctx_free( ctx );
+}
@@ -0,0 +1,109 @@
+/**
+ * @file znet_ctx.h
+ * @date 18 Oct 2026
+ * @brief Library context: all state of one controller.
+ */
+
+#ifndef ZNET_CTX_H
+#define ZNET_CTX_H
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_main.h"
+#include "znet_inflight.h"
+#include "znet_dispatch.h"
+#include "znet_param_db.h"
+#include "znet_config_walk.h"
+#include "znet_config_backup.h"
+#include "znet_uart.h"
+#include "znet_deferred.h"
+#include "znet_rtt.h"
+#include "znet_airtime.h"
+#include "znet_health.h"
+#include "znet_interview.h"
+#include "znet_persist.h"
+#include "znet_state.h"
+#include "znet_subscribe.h"
+#include "znet_meter_series.h"
+#include "znet_mem.h"
+
+/// INFO: internal
+#include <znet_lib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Library context
+ *
+ * Nothing outside of the context is shared, so different contexts can be
+ * driven from different threads. One context must not be used from several
+ * threads at the same time.
+ */
+struct znet_ctx_t
+{
+    ZNet znet;                                /**< Z-Wave stack instance */
+    const znet_callbacks_t* cb;               /**< User callbacks */
+    znet_uart_t uart;                         /**< Transmit path */
+    znet_inflight_t inflight[ZNET_INFLIGHT_MAX]; /**< Outstanding GETs */
+    znet_dispatch_t dispatch;                 /**< Callbacks dispatcher */
+#if ZNET_CFG_CC_CONFIGURATION
+    znet_param_db_t param_db;                 /**< Parameters metadata */
+    znet_config_walk_t walks[ZNET_CONFIG_WALK_MAX]; /**< Discoveries */
+    znet_config_backup_t backups[ZNET_CONFIG_BACKUP_MAX]; /**< Backups */
+#endif
+    znet_deferred_t deferred;                 /**< Held for sleeping nodes */
+    znet_rtt_t rtt[ZNET_NODE_ID_MAX + 1];     /**< Round-trip of nodes */
+    znet_airtime_t airtime;                   /**< Transmit budget */
+    znet_health_table_t health;               /**< Failed nodes */
+    znet_interview_queue_t interview;         /**< Background interviews */
+    znet_persist_t persist;                   /**< Dirty records write-back */
+    znet_state_table_t state;                 /**< Last known values */
+    znet_subscribe_t subscribe;               /**< Subscriptions */
+#if ZNET_CFG_CC_METER
+    znet_meter_series_table_t meter_series;   /**< History of meters */
+#endif
+    znet_mem_t mem;                           /**< Memory counters, pools */
+};
+
+/**
+ * @brief Context used by the API without explicit context
+ *
+ * Created by znet_init.
+ */
+extern znet_ctx_t* znet_ctx_default;
+
+/// INFO: core, implemented with the stack in znet_main.c
+
+/// INFO: the core writes frames through znet_uart_write, not uart_write
+
+/**
+ * @brief Init stack instance of the context
+ *
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_main_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Process incoming data of the context
+ */
+void znet_main_proc( znet_ctx_t* ctx );
+
+/**
+ * @brief Release stack instance of the context
+ */
+void znet_main_free( znet_ctx_t* ctx );
+
+/**
+ * @brief Get context owning the stack function
+ */
+znet_ctx_t* znet_main_ctx( const ZFunction func );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_CTX_H
@@ -0,0 +1,499 @@
+/**
+ * @file znet_deferred.c
+ * @date 18 Oct 2026
+ * @brief Commands held for sleeping nodes, paced Sets and commands waiting
+ * for airtime.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_deferred.h"
+#include "znet_airtime.h"
+#include "znet_health.h"
+#include "znet_cmd_configuration.h"
+
+static int _znet_deferred_is_set( uint8_t op )
+{
+    return op == ZNET_DEFERRED_CONFIGURATION_SET ||
+           op == ZNET_DEFERRED_CONFIGURATION_BULK_SET;
+}
+
+/// INFO: without Wake Up nothing would ever flush the commands of a sleeping
+/// node, so no node sleeps
+static int _znet_deferred_sleeping( const znet_deferred_t* deferred,
+                                    znet_node_id_t node_id )
+{
+#if ZNET_CFG_CC_WAKE_UP
+    return deferred->sleeping[node_id];
+#else
+    (void)deferred;
+    (void)node_id;
+    return 0;
+#endif
+}
+
+static int _znet_deferred_is_get( uint8_t op )
+{
+    return op == ZNET_DEFERRED_CONFIGURATION_GET ||
+           op == ZNET_DEFERRED_CONFIGURATION_BULK_GET ||
+           op == ZNET_DEFERRED_CONFIGURATION_NAME_GET ||
+           op == ZNET_DEFERRED_CONFIGURATION_INFO_GET ||
+           op == ZNET_DEFERRED_CONFIGURATION_PROPERTIES_GET;
+}
+
+/// INFO: slot is free before the replay, it may hold a new command
+static void _znet_deferred_release( znet_deferred_t* deferred,
+                                    znet_deferred_cmd_t* cmd )
+{
+    if( cmd->flags & ZNET_DEFERRED_FLAG_THROTTLED )
+        deferred->throttled--;
+    if( cmd->flags & ZNET_DEFERRED_FLAG_PACED )
+        deferred->paced--;
+    cmd->seq = 0;
+}
+
+static znet_deferred_target_t* _znet_deferred_target(
+    znet_deferred_t* deferred, const znet_deferred_cmd_t* cmd, int create )
+{
+    znet_deferred_target_t* oldest = &deferred->targets[0];
+    for( size_t i = 0; i < ZNET_DEFERRED_TARGETS; i++ )
+    {
+        znet_deferred_target_t* it = &deferred->targets[i];
+        if( it->node_id == cmd->node_id && it->channel_id == cmd->channel_id &&
+            it->op == cmd->op && it->param == cmd->param )
+            return it;
+        if( it->tx_time < oldest->tx_time )
+            oldest = it;
+    }
+
+    if( !create )
+        return NULL;
+
+    oldest->node_id = cmd->node_id;
+    oldest->channel_id = cmd->channel_id;
+    oldest->op = cmd->op;
+    oldest->param = cmd->param;
+    return oldest;
+}
+
+/// INFO: command leaves now
+static void _znet_deferred_sent( znet_ctx_t* ctx, const znet_deferred_cmd_t* cmd,
+                                 size_t payload )
+{
+    znet_deferred_t* deferred = &ctx->deferred;
+
+    znet_airtime_charge( ctx, cmd->node_id, payload );
+    if( deferred->interval_ms && _znet_deferred_is_set( cmd->op ) )
+        _znet_deferred_target( deferred, cmd, 1 )->tx_time =
+            ctx->cb->clock( ctx->cb->arg );
+}
+
+static int _znet_deferred_same( const znet_deferred_cmd_t* a,
+                                const znet_deferred_cmd_t* b )
+{
+    return a->op == b->op && a->node_id == b->node_id &&
+           a->channel_id == b->channel_id && a->param == b->param &&
+           a->count == b->count;
+}
+
+/// INFO: size of command class payload, encapsulation adds Multi Channel
+static size_t _znet_deferred_payload( const znet_deferred_cmd_t* cmd )
+{
+    size_t size = cmd->channel_id != ZNET_CHANNEL_ID_ROOT ? 4 : 0;
+    switch( cmd->op )
+    {
+    case ZNET_DEFERRED_CONFIGURATION_GET:
+        return size + 3;
+    case ZNET_DEFERRED_CONFIGURATION_SET:
+        return size + 4 + cmd->size;
+    case ZNET_DEFERRED_CONFIGURATION_BULK_GET:
+        return size + 5;
+    case ZNET_DEFERRED_CONFIGURATION_BULK_SET:
+        return size + 6 + (size_t)cmd->count * cmd->size;
+    case ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET:
+        return size + 2;
+    default:
+        return size + 4;
+    }
+}
+
+static void _znet_deferred_replay( znet_ctx_t* ctx, const znet_deferred_cmd_t* cmd )
+{
+#if !ZNET_CFG_CC_CONFIGURATION
+    (void)ctx;
+#endif
+
+    switch( cmd->op )
+    {
+#if ZNET_CFG_CC_CONFIGURATION
+    case ZNET_DEFERRED_CONFIGURATION_GET:
+        znet_configuration_get( ctx, cmd->node_id, cmd->channel_id,
+                                (uint8_t)cmd->param, cmd->waiters );
+        break;
+    case ZNET_DEFERRED_CONFIGURATION_SET:
+        znet_ctx_node_cmd_configuration_set( ctx, cmd->node_id, cmd->channel_id,
+            (uint8_t)cmd->param, cmd->size,
+            cmd->flags & ZNET_DEFERRED_FLAG_DEFAULT, cmd->value );
+        break;
+    case ZNET_DEFERRED_CONFIGURATION_BULK_GET:
+        znet_ctx_node_cmd_configuration_bulk_get( ctx, cmd->node_id,
+            cmd->channel_id, cmd->param, cmd->count );
+        break;
+    case ZNET_DEFERRED_CONFIGURATION_BULK_SET:
+        znet_ctx_node_cmd_configuration_bulk_set( ctx, cmd->node_id,
+            cmd->channel_id, cmd->param, cmd->count, cmd->size,
+            cmd->flags & ZNET_DEFERRED_FLAG_REPORT,
+            cmd->flags & ZNET_DEFERRED_FLAG_DEFAULT, cmd->data );
+        break;
+    case ZNET_DEFERRED_CONFIGURATION_NAME_GET:
+        znet_ctx_node_cmd_configuration_name_get( ctx, cmd->node_id,
+                                                  cmd->channel_id, cmd->param );
+        break;
+    case ZNET_DEFERRED_CONFIGURATION_INFO_GET:
+        znet_ctx_node_cmd_configuration_info_get( ctx, cmd->node_id,
+                                                  cmd->channel_id, cmd->param );
+        break;
+    case ZNET_DEFERRED_CONFIGURATION_PROPERTIES_GET:
+        znet_ctx_node_cmd_configuration_properties_get( ctx, cmd->node_id,
+            cmd->channel_id, cmd->param );
+        break;
+    case ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET:
+        znet_ctx_node_cmd_configuration_default_reset( ctx, cmd->node_id,
+                                                       cmd->channel_id );
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+/// INFO: send held commands of node in the order they were issued
+static void _znet_deferred_flush( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    znet_deferred_t* deferred = &ctx->deferred;
+
+    deferred->replay_node = node_id;
+    for( ;; )
+    {
+        znet_deferred_cmd_t* first = NULL;
+        for( size_t i = 0; i < ZNET_DEFERRED_MAX; i++ )
+        {
+            znet_deferred_cmd_t* cmd = &deferred->cmds[i];
+            if( cmd->seq && cmd->node_id == node_id &&
+                ( !first || cmd->seq < first->seq ) )
+                first = cmd;
+        }
+        if( !first )
+            break;
+
+        znet_deferred_cmd_t cmd = *first;
+        _znet_deferred_release( deferred, first );
+        _znet_deferred_replay( ctx, &cmd );
+    }
+    deferred->replay_node = ZNET_NODE_ID_INVALID;
+}
+
+/// INFO: an older held command of the same node and channel goes first
+static int _znet_deferred_blocked( const znet_deferred_t* deferred,
+                                   const znet_deferred_cmd_t* cmd )
+{
+    for( size_t i = 0; i < ZNET_DEFERRED_MAX; i++ )
+    {
+        const znet_deferred_cmd_t* it = &deferred->cmds[i];
+        if( it->seq && it->seq < cmd->seq && it->node_id == cmd->node_id &&
+            it->channel_id == cmd->channel_id )
+            return 1;
+    }
+    return 0;
+}
+
+/// INFO: oldest command of the queue (flag) that may go now
+static znet_deferred_cmd_t* _znet_deferred_first( znet_ctx_t* ctx, uint8_t flag,
+                                                  uint64_t now )
+{
+    znet_deferred_t* deferred = &ctx->deferred;
+    znet_deferred_cmd_t* first = NULL;
+    for( size_t i = 0; i < ZNET_DEFERRED_MAX; i++ )
+    {
+        znet_deferred_cmd_t* cmd = &deferred->cmds[i];
+        if( !cmd->seq || !( cmd->flags & flag ) ||
+            ( first && cmd->seq > first->seq ) )
+            continue;
+        if( ( flag & ZNET_DEFERRED_FLAG_PACED ) && now < cmd->due )
+            continue;
+        if( _znet_deferred_blocked( deferred, cmd ) )
+            continue;
+        first = cmd;
+    }
+    return first;
+}
+
+void znet_deferred_init( znet_ctx_t* ctx )
+{
+    znet_deferred_t* deferred = &ctx->deferred;
+
+    memset( deferred, 0, sizeof( znet_deferred_t ) );
+    deferred->replay_node = ZNET_NODE_ID_INVALID;
+    for( size_t i = 0; i < ZNET_DEFERRED_TARGETS; i++ )
+        deferred->targets[i].node_id = ZNET_NODE_ID_INVALID;
+}
+
+int znet_deferred_hold( znet_ctx_t* ctx, const znet_deferred_cmd_t* cmd )
+{
+    znet_deferred_t* deferred = &ctx->deferred;
+    size_t payload = _znet_deferred_payload( cmd );
+    uint8_t queue = 0;
+    uint64_t due = 0;
+
+    int too_big = cmd->op == ZNET_DEFERRED_CONFIGURATION_BULK_SET &&
+                  (size_t)cmd->count * cmd->size > ZNET_DEFERRED_DATA_MAX;
+
+    /// INFO: failed node costs no airtime, a GET probes it now and then
+    int sleeping = _znet_deferred_sleeping( deferred, cmd->node_id );
+    if( !sleeping &&
+        !znet_health_admit( ctx, cmd->node_id,
+                            _znet_deferred_is_get( cmd->op ) &&
+                                !deferred->throttled ) )
+    {
+        ZNET_LOGD( "ZNET: Command to failed node %u rejected\n", cmd->node_id );
+        return -1;
+    }
+
+    /// INFO: replay of held command
+    if( cmd->node_id == deferred->replay_node )
+    {
+        _znet_deferred_sent( ctx, cmd, payload );
+        return 0;
+    }
+
+    /// INFO: held commands of the target are superseded first, a command
+    /// that is left goes out before the new one
+    znet_deferred_cmd_t* slot = NULL;
+    int behind = 0;
+    for( size_t i = 0; i < ZNET_DEFERRED_MAX; i++ )
+    {
+        znet_deferred_cmd_t* it = &deferred->cmds[i];
+        if( !it->seq )
+        {
+            if( !slot )
+                slot = it;
+            continue;
+        }
+        if( it->node_id != cmd->node_id || it->channel_id != cmd->channel_id )
+            continue;
+
+        /// INFO: superseded by the new command
+        if( cmd->op == ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET &&
+            ( _znet_deferred_is_set( it->op ) || it->op == cmd->op ) )
+        {
+            _znet_deferred_release( deferred, it );
+            if( !slot )
+                slot = it;
+            continue;
+        }
+
+        if( _znet_deferred_same( it, cmd ) )
+        {
+            /// INFO: the latest value wins, the place in the queue is kept
+            if( _znet_deferred_is_set( cmd->op ) )
+            {
+                uint32_t seq = it->seq;
+                uint8_t flags = it->flags & ( ZNET_DEFERRED_FLAG_PACED |
+                                              ZNET_DEFERRED_FLAG_THROTTLED );
+                uint64_t it_due = it->due;
+                *it = *cmd;
+                it->seq = seq;
+                it->flags |= flags;
+                it->due = it_due;
+                return 1;
+            }
+
+            /// INFO: every caller gets the report of the GET; other GETs
+            /// are not tracked, each is held for its caller
+            if( cmd->op == ZNET_DEFERRED_CONFIGURATION_GET &&
+                it->waiters <= UINT8_MAX - cmd->waiters )
+            {
+                it->waiters += cmd->waiters;
+                return 1;
+            }
+        }
+        behind = 1;
+    }
+
+    if( too_big )
+    {
+        if( sleeping || behind )
+        {
+            ZNET_LOGE( "ZNET: Bulk Set is too big to wait for node %u!\n",
+                       cmd->node_id );
+            return -1;
+        }
+
+        /// INFO: a command that can not be held goes over the budget
+        _znet_deferred_sent( ctx, cmd, payload );
+        return 0;
+    }
+
+    if( !sleeping )
+    {
+        const znet_deferred_target_t* target = NULL;
+        if( deferred->interval_ms && _znet_deferred_is_set( cmd->op ) )
+            target = _znet_deferred_target( deferred, cmd, 0 );
+
+        uint64_t now = ctx->cb->clock( ctx->cb->arg );
+        if( target && now - target->tx_time < deferred->interval_ms )
+        {
+            queue = ZNET_DEFERRED_FLAG_PACED;
+            due = target->tx_time + deferred->interval_ms;
+        }
+        /// INFO: keep the order behind commands already waiting for airtime
+        /// and behind held commands of the target
+        else if( !behind &&
+                 ( !deferred->throttled ||
+                   !_znet_deferred_first( ctx, ZNET_DEFERRED_FLAG_THROTTLED, 0 ) ) &&
+                 znet_airtime_admit( ctx, cmd->node_id, payload ) )
+        {
+            _znet_deferred_sent( ctx, cmd, payload );
+            return 0;
+        }
+        else
+            queue = ZNET_DEFERRED_FLAG_THROTTLED;
+    }
+
+    if( !slot )
+    {
+        ZNET_LOGE( "ZNET: No room for held command of node %u!\n",
+                   cmd->node_id );
+        return -1;
+    }
+
+    *slot = *cmd;
+    slot->seq = ++deferred->seq;
+    slot->flags |= queue;
+    slot->due = due;
+    if( queue == ZNET_DEFERRED_FLAG_THROTTLED )
+    {
+        deferred->throttled++;
+        znet_airtime_throttled( ctx );
+    }
+    if( queue == ZNET_DEFERRED_FLAG_PACED )
+        deferred->paced++;
+    return 1;
+}
+
+static void _znet_deferred_send_held( znet_ctx_t* ctx, znet_deferred_cmd_t* held )
+{
+    znet_deferred_t* deferred = &ctx->deferred;
+
+    znet_deferred_cmd_t cmd = *held;
+    _znet_deferred_release( deferred, held );
+
+    deferred->replay_node = cmd.node_id;
+    _znet_deferred_replay( ctx, &cmd );
+    deferred->replay_node = ZNET_NODE_ID_INVALID;
+}
+
+void znet_deferred_proc( znet_ctx_t* ctx )
+{
+    znet_deferred_t* deferred = &ctx->deferred;
+
+    /// INFO: due Sets carry the latest value, they wait for airtime no more
+    if( deferred->paced )
+    {
+        uint64_t now = ctx->cb->clock( ctx->cb->arg );
+        znet_deferred_cmd_t* first;
+        while( ( first = _znet_deferred_first( ctx, ZNET_DEFERRED_FLAG_PACED,
+                                               now ) ) )
+            _znet_deferred_send_held( ctx, first );
+    }
+
+    while( deferred->throttled )
+    {
+        znet_deferred_cmd_t* first =
+            _znet_deferred_first( ctx, ZNET_DEFERRED_FLAG_THROTTLED, 0 );
+        if( !first ||
+            !znet_airtime_admit( ctx, first->node_id,
+                                 _znet_deferred_payload( first ) ) )
+            break;
+
+        _znet_deferred_send_held( ctx, first );
+    }
+}
+
+#if ZNET_CFG_CC_WAKE_UP
+void znet_deferred_wakeup( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
+        return;
+
+    /// INFO: only sleeping nodes send Wake Up Notification
+    ctx->deferred.sleeping[node_id] = 1;
+
+    _znet_deferred_flush( ctx, node_id );
+
+    /// INFO: the node may go back to sleep after the held commands
+    if( !znet_cc_wake_up_no_more_information( &ctx->znet, node_id, NULL, NULL,
+                                              Encapsulation_None ) )
+        ZNET_LOGW( "ZNET: No More Information to node %u failed!\n", node_id );
+}
+#endif  // ZNET_CFG_CC_WAKE_UP
+
+int znet_ctx_node_sleeping( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            int sleeping )
+{
+    if( !ctx )
+        return -1;
+
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
+        return -1;
+
+#if ZNET_CFG_CC_WAKE_UP
+    ctx->deferred.sleeping[node_id] = sleeping ? 1 : 0;
+#else
+    if( sleeping )
+    {
+        ZNET_LOGE( "ZNET: Node %u can not sleep without Wake Up!\n", node_id );
+        return -1;
+    }
+#endif
+
+    /// INFO: node is reachable now, nothing to wait for
+    if( !sleeping )
+        _znet_deferred_flush( ctx, node_id );
+    return 0;
+}
+
+int znet_ctx_set_interval( znet_ctx_t* ctx, uint32_t interval_ms )
+{
+    if( !ctx )
+        return -1;
+
+    znet_deferred_t* deferred = &ctx->deferred;
+    deferred->interval_ms = interval_ms;
+    for( size_t i = 0; i < ZNET_DEFERRED_TARGETS; i++ )
+    {
+        deferred->targets[i].node_id = ZNET_NODE_ID_INVALID;
+        deferred->targets[i].tx_time = 0;
+    }
+    return 0;
+}
+
+size_t znet_ctx_node_deferred_count( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    if( !ctx )
+        return 0;
+
+    size_t count = 0;
+    for( size_t i = 0; i < ZNET_DEFERRED_MAX; i++ )
+        if( ctx->deferred.cmds[i].seq && ctx->deferred.cmds[i].node_id == node_id )
+            count++;
+    return count;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file znet_deferred.h
+ * @date 18 Oct 2026
+ * @brief Commands held for sleeping nodes, paced Sets and commands waiting
+ * for airtime.
+ */
+
+#ifndef ZNET_DEFERRED_H
+#define ZNET_DEFERRED_H
+
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max number of held commands of all nodes
+ */
+#define ZNET_DEFERRED_MAX 64
+
+/**
+ * @brief Max size of data of held command (Bulk Set)
+ */
+#define ZNET_DEFERRED_DATA_MAX 32
+
+/**
+ * @brief Held command
+ */
+typedef enum znet_deferred_op_t {
+    ZNET_DEFERRED_NONE = 0,
+    ZNET_DEFERRED_CONFIGURATION_GET,
+    ZNET_DEFERRED_CONFIGURATION_SET,
+    ZNET_DEFERRED_CONFIGURATION_BULK_GET,
+    ZNET_DEFERRED_CONFIGURATION_BULK_SET,
+    ZNET_DEFERRED_CONFIGURATION_NAME_GET,
+    ZNET_DEFERRED_CONFIGURATION_INFO_GET,
+    ZNET_DEFERRED_CONFIGURATION_PROPERTIES_GET,
+    ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET,
+} znet_deferred_op_t;
+
+#define ZNET_DEFERRED_FLAG_DEFAULT 0x01 /**< Set to default */
+#define ZNET_DEFERRED_FLAG_REPORT 0x02  /**< Report requested */
+#define ZNET_DEFERRED_FLAG_PACED 0x40     /**< Waits for min interval of target */
+#define ZNET_DEFERRED_FLAG_THROTTLED 0x80 /**< Waits for airtime, not wake up */
+
+/**
+ * @brief Number of recently sent Set targets tracked for min interval
+ */
+#define ZNET_DEFERRED_TARGETS 32
+
+/**
+ * @brief Held command with its arguments
+ */
+typedef struct znet_deferred_cmd_t
+{
+    uint32_t seq;                          /**< Order, 0 - free slot */
+    uint8_t op;                            /**< ZNET_DEFERRED_* */
+    uint8_t flags;                         /**< ZNET_DEFERRED_FLAG_* */
+    znet_node_id_t node_id;                /**< Node ID */
+    znet_node_channel_id_t channel_id;     /**< Channel ID */
+    znet_cmd_configuration_id_t param;     /**< Parameter Number */
+    uint8_t size;                          /**< Size of value */
+    uint8_t count;                         /**< Parameters count (bulk) */
+    znet_cmd_configuration_value_t value;  /**< Value (set) */
+    uint8_t data[ZNET_DEFERRED_DATA_MAX];  /**< Values (bulk set) */
+    uint8_t waiters;                       /**< Callers of held GET */
+    uint64_t due;                          /**< Send time when paced (ms) */
+} znet_deferred_cmd_t;
+
+/**
+ * @brief Last Set sent to target
+ */
+typedef struct znet_deferred_target_t
+{
+    znet_node_id_t node_id;            /**< Node ID, INVALID - free slot */
+    znet_node_channel_id_t channel_id; /**< Channel ID */
+    uint8_t op;                        /**< ZNET_DEFERRED_* */
+    znet_cmd_configuration_id_t param; /**< Parameter Number */
+    uint64_t tx_time;                  /**< Time of transmit (ms) */
+} znet_deferred_target_t;
+
+/**
+ * @brief Held commands of the context
+ */
+typedef struct znet_deferred_t
+{
+    uint32_t seq;                            /**< Last order number */
+    uint16_t throttled;                      /**< Commands waiting for airtime */
+    uint16_t paced;                          /**< Sets waiting for interval */
+    uint32_t interval_ms;                    /**< Min interval of Sets, 0 - off */
+    znet_deferred_target_t targets[ZNET_DEFERRED_TARGETS]; /**< Sent Sets */
+    znet_node_id_t replay_node;              /**< Node flushed now */
+#if ZNET_CFG_CC_WAKE_UP
+    uint8_t sleeping[ZNET_NODE_ID_MAX + 1];  /**< flag: node sleeps */
+#endif
+    znet_deferred_cmd_t cmds[ZNET_DEFERRED_MAX]; /**< Held commands */
+} znet_deferred_t;
+
+/**
+ * @brief Init empty queue, all nodes are listening
+ */
+void znet_deferred_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Hold command if its node sleeps, its target got a Set within the
+ * min interval or the airtime budget is exhausted
+ *
+ * A Set replaces the held Set of the same target (latest value wins), Default
+ * Reset drops the held Sets of the channel, identical Configuration Gets are
+ * held once with the count of their callers. A command is held behind the
+ * commands of its node and channel that are left, they go out in order.
+ * A command that is sent now is charged to the airtime budget. A command to
+ * failed listening node is rejected unless it probes the node.
+ *
+ * @param cmd Command, seq is ignored
+ * @return 0 - send now, 1 - held, -1 - node is failed or command has to wait
+ * but the queue is full
+ */
+int znet_deferred_hold( znet_ctx_t* ctx, const znet_deferred_cmd_t* cmd );
+
+/**
+ * @brief Send paced Sets that are due and commands waiting for airtime as
+ * far as the budget allows
+ */
+void znet_deferred_proc( znet_ctx_t* ctx );
+
+#if ZNET_CFG_CC_WAKE_UP
+/**
+ * @brief Node is awake: send held commands back-to-back, then No More
+ * Information
+ *
+ * Called on Wake Up Notification, the node is marked as sleeping.
+ */
+void znet_deferred_wakeup( znet_ctx_t* ctx, znet_node_id_t node_id );
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_DEFERRED_H
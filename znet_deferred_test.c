@@ -0,0 +1,336 @@
+/**
+ * @file znet_deferred_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of held commands.
+ *
+ * The module is built into the test, the commands it replays are recorded by
+ * fakes. Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_deferred_test.c -o znet_deferred_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_deferred.c"
+
+#if ZNET_CFG_CC_CONFIGURATION && ZNET_CFG_CC_WAKE_UP
+
+#define TEST_NODE 5
+#define TEST_SENT_MAX 16
+
+/// INFO: command replayed by the module
+typedef struct test_sent_t
+{
+    uint8_t op;
+    uint16_t param;
+    uint8_t waiters;
+    uint32_t value;
+} test_sent_t;
+
+static struct
+{
+    uint64_t now;
+    int admit;
+    test_sent_t sent[TEST_SENT_MAX];
+    size_t count;
+} test;
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return test.now;
+}
+
+static void _test_sent( uint8_t op, uint16_t param, uint8_t waiters,
+                        uint32_t value )
+{
+    assert( test.count < TEST_SENT_MAX );
+    test_sent_t* sent = &test.sent[test.count++];
+    sent->op = op;
+    sent->param = param;
+    sent->waiters = waiters;
+    sent->value = value;
+}
+
+int znet_airtime_admit( znet_ctx_t* ctx, znet_node_id_t node_id, size_t payload )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)payload;
+    return test.admit;
+}
+
+void znet_airtime_charge( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          size_t payload )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)payload;
+}
+
+void znet_airtime_throttled( znet_ctx_t* ctx )
+{
+    (void)ctx;
+}
+
+int znet_health_admit( znet_ctx_t* ctx, znet_node_id_t node_id, int probe )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)probe;
+    return 1;
+}
+
+/// INFO: the senders hold their command like the real ones, a replay goes out
+static void _test_send( znet_ctx_t* ctx, const znet_deferred_cmd_t* cmd )
+{
+    if( znet_deferred_hold( ctx, cmd ) )
+        return;
+    _test_sent( cmd->op, cmd->param, cmd->waiters, cmd->value );
+}
+
+void znet_configuration_get( znet_ctx_t* ctx, znet_node_id_t node_id,
+                             znet_node_channel_id_t channel_id,
+                             uint8_t config_param_num, uint8_t waiters )
+{
+    znet_deferred_cmd_t cmd = {
+        .op = ZNET_DEFERRED_CONFIGURATION_GET, .node_id = node_id,
+        .channel_id = channel_id, .param = config_param_num,
+        .waiters = waiters };
+    _test_send( ctx, &cmd );
+}
+
+void znet_ctx_node_cmd_configuration_set(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    uint8_t config_param_num, uint8_t config_size, int set_to_default,
+    znet_cmd_configuration_value_t config_value )
+{
+    znet_deferred_cmd_t cmd = {
+        .op = ZNET_DEFERRED_CONFIGURATION_SET, .node_id = node_id,
+        .channel_id = channel_id, .param = config_param_num,
+        .size = config_size, .value = config_value,
+        .flags = set_to_default ? ZNET_DEFERRED_FLAG_DEFAULT : 0 };
+    _test_send( ctx, &cmd );
+}
+
+void znet_ctx_node_cmd_configuration_bulk_set(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t config_id, uint8_t config_count,
+    uint8_t config_size, int need_report, int set_to_default,
+    const uint8_t* config_value )
+{
+    (void)need_report;
+    (void)set_to_default;
+    (void)config_value;
+    znet_deferred_cmd_t cmd = {
+        .op = ZNET_DEFERRED_CONFIGURATION_BULK_SET, .node_id = node_id,
+        .channel_id = channel_id, .param = config_id, .count = config_count,
+        .size = config_size };
+    _test_send( ctx, &cmd );
+}
+
+void znet_ctx_node_cmd_configuration_bulk_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t config_id, uint8_t config_count )
+{
+    znet_deferred_cmd_t cmd = {
+        .op = ZNET_DEFERRED_CONFIGURATION_BULK_GET, .node_id = node_id,
+        .channel_id = channel_id, .param = config_id, .count = config_count };
+    _test_send( ctx, &cmd );
+}
+
+void znet_ctx_node_cmd_configuration_name_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    _test_sent( ZNET_DEFERRED_CONFIGURATION_NAME_GET, param_number, 0, 0 );
+}
+
+void znet_ctx_node_cmd_configuration_info_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    _test_sent( ZNET_DEFERRED_CONFIGURATION_INFO_GET, param_number, 0, 0 );
+}
+
+void znet_ctx_node_cmd_configuration_properties_get(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+    znet_cmd_configuration_id_t param_number )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    _test_sent( ZNET_DEFERRED_CONFIGURATION_PROPERTIES_GET, param_number, 0, 0 );
+}
+
+void znet_ctx_node_cmd_configuration_default_reset(
+    znet_ctx_t* ctx, znet_node_id_t node_id, znet_node_channel_id_t channel_id )
+{
+    znet_deferred_cmd_t cmd = {
+        .op = ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET, .node_id = node_id,
+        .channel_id = channel_id };
+    _test_send( ctx, &cmd );
+}
+
+BOOL znet_cc_wake_up_no_more_information( ZNet* znet, uint8_t node_id,
+                                          ZFuncCallback cb, void* arg,
+                                          encap_type_t encap )
+{
+    (void)znet;
+    (void)node_id;
+    (void)cb;
+    (void)arg;
+    (void)encap;
+    return TRUE;
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_deferred_init( &_test_ctx );
+    test.now = 1000000;
+    test.admit = 1;
+    return &_test_ctx;
+}
+
+/// INFO: identical GETs for a sleeping node are sent once for all callers
+static void _test_get_waiters( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( !znet_ctx_node_sleeping( ctx, TEST_NODE, 1 ) );
+
+    znet_configuration_get( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 3, 1 );
+    znet_configuration_get( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 3, 1 );
+    znet_configuration_get( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 3, 2 );
+    znet_ctx_node_cmd_configuration_bulk_get( ctx, TEST_NODE,
+                                              ZNET_CHANNEL_ID_ROOT, 1, 4 );
+    znet_ctx_node_cmd_configuration_bulk_get( ctx, TEST_NODE,
+                                              ZNET_CHANNEL_ID_ROOT, 1, 4 );
+    assert( test.count == 0 );
+    assert( znet_ctx_node_deferred_count( ctx, TEST_NODE ) == 3 );
+
+    /// INFO: other GETs are not tracked, each caller gets its own
+    znet_deferred_wakeup( ctx, TEST_NODE );
+    assert( test.count == 3 );
+    assert( test.sent[0].op == ZNET_DEFERRED_CONFIGURATION_GET );
+    assert( test.sent[0].param == 3 && test.sent[0].waiters == 4 );
+    assert( test.sent[1].op == ZNET_DEFERRED_CONFIGURATION_BULK_GET );
+    assert( test.sent[2].op == ZNET_DEFERRED_CONFIGURATION_BULK_GET );
+    assert( znet_ctx_node_deferred_count( ctx, TEST_NODE ) == 0 );
+}
+
+/// INFO: the latest value of a held Set wins, its place is kept
+static void _test_latest_wins( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( !znet_ctx_node_sleeping( ctx, TEST_NODE, 1 ) );
+
+    znet_cmd_configuration_value_t value = 1;
+    znet_ctx_node_cmd_configuration_set( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                         7, 1, 0, value );
+    znet_configuration_get( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 7, 1 );
+    value = 2;
+    znet_ctx_node_cmd_configuration_set( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                         7, 1, 0, value );
+
+    assert( !znet_ctx_node_sleeping( ctx, TEST_NODE, 0 ) );
+    assert( test.count == 2 );
+    assert( test.sent[0].op == ZNET_DEFERRED_CONFIGURATION_SET );
+    assert( test.sent[0].value == 2 );
+    assert( test.sent[1].op == ZNET_DEFERRED_CONFIGURATION_GET );
+}
+
+/// INFO: a Default Reset drops the paced Set, an older Set never overrides it
+static void _test_reset_supersedes( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( !znet_ctx_set_interval( ctx, 1000 ) );
+
+    znet_ctx_node_cmd_configuration_set( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                         7, 1, 0, 1 );
+    znet_ctx_node_cmd_configuration_set( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                         7, 1, 0, 2 );
+    assert( test.count == 1 && ctx->deferred.paced == 1 );
+
+    znet_ctx_node_cmd_configuration_default_reset( ctx, TEST_NODE,
+                                                   ZNET_CHANNEL_ID_ROOT );
+    assert( test.count == 2 );
+    assert( test.sent[1].op == ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET );
+    assert( ctx->deferred.paced == 0 );
+
+    test.now += 2000;
+    znet_deferred_proc( ctx );
+    assert( test.count == 2 );
+}
+
+/// INFO: a command that could go now waits behind held commands of its
+/// channel
+static void _test_order( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( !znet_ctx_set_interval( ctx, 1000 ) );
+
+    znet_ctx_node_cmd_configuration_set( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                         1, 1, 0, 1 );
+    znet_ctx_node_cmd_configuration_set( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                         1, 1, 0, 2 );
+    znet_ctx_node_cmd_configuration_set( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                         2, 1, 0, 3 );
+    znet_ctx_node_cmd_configuration_default_reset( ctx, TEST_NODE, 1 );
+    assert( test.count == 2 );
+    assert( test.sent[1].op == ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET );
+
+    znet_deferred_proc( ctx );
+    assert( test.count == 2 );
+
+    test.now += 1000;
+    znet_deferred_proc( ctx );
+    assert( test.count == 4 );
+    assert( test.sent[2].param == 1 && test.sent[2].value == 2 );
+    assert( test.sent[3].param == 2 && test.sent[3].value == 3 );
+
+    /// INFO: behind a command waiting for airtime
+    test.admit = 0;
+    znet_configuration_get( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, 3, 1 );
+    test.admit = 1;
+    znet_ctx_node_cmd_configuration_default_reset( ctx, TEST_NODE,
+                                                   ZNET_CHANNEL_ID_ROOT );
+    assert( test.count == 4 );
+    znet_deferred_proc( ctx );
+    assert( test.count == 6 );
+    assert( test.sent[4].op == ZNET_DEFERRED_CONFIGURATION_GET );
+    assert( test.sent[5].op == ZNET_DEFERRED_CONFIGURATION_DEFAULT_RESET );
+}
+
+int main( void )
+{
+    _test_get_waiters();
+    _test_latest_wins();
+    _test_reset_supersedes();
+    _test_order();
+    printf( "znet_deferred_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION && ZNET_CFG_CC_WAKE_UP
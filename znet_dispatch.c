@@ -0,0 +1,337 @@
+/**
+ * @file znet_dispatch.c
+ * @date 18 Oct 2026
+ * @brief Delivery of results/reports to the user callbacks.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_dispatch.h"
+#include "znet_subscribe.h"
+#include "znet_mem.h"
+
+static int _znet_event_has_cb( const znet_callbacks_t* cb,
+                               znet_event_type_t type )
+{
+    switch( type )
+    {
+#if ZNET_CFG_CC_CONFIGURATION
+    case ZNET_EVENT_CONFIGURATION:
+    case ZNET_EVENT_CONFIGURATION_SET:
+        return cb->node_cmd_configuration_result != NULL;
+    case ZNET_EVENT_CONFIGURATION_BULK:
+    case ZNET_EVENT_CONFIGURATION_BULK_SET:
+        return cb->node_cmd_configuration_bulk_result != NULL;
+    case ZNET_EVENT_CONFIGURATION_BULK_VALUES:
+        return cb->node_cmd_configuration_bulk_values_result != NULL;
+    case ZNET_EVENT_CONFIGURATION_NAME:
+        return cb->node_cmd_configuration_name_result != NULL;
+    case ZNET_EVENT_CONFIGURATION_INFO:
+        return cb->node_cmd_configuration_info_result != NULL;
+    case ZNET_EVENT_CONFIGURATION_PROPERTIES:
+        return cb->node_cmd_configuration_properties_result != NULL;
+    case ZNET_EVENT_CONFIGURATION_WALK:
+        return cb->node_cmd_configuration_walk_result != NULL;
+    case ZNET_EVENT_CONFIGURATION_BACKUP:
+        return cb->node_cmd_configuration_backup_result != NULL;
+    case ZNET_EVENT_CONFIGURATION_RESTORE:
+        return cb->node_cmd_configuration_restore_result != NULL;
+#endif
+    case ZNET_EVENT_NODE_HEALTH:
+        return cb->node_health_result != NULL;
+    case ZNET_EVENT_NODE_INTERVIEW:
+        return cb->node_interview_result != NULL;
+    default:
+        return 0;
+    }
+}
+
+static void _znet_event_call( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                              znet_node_id_t node_id,
+                              znet_node_channel_id_t channel_id,
+                              const void* value, size_t size )
+{
+    const znet_callbacks_t* cb = ctx->cb;
+
+    /// INFO: subscriptions first, the callback may be missing
+    znet_subscribe_notify( ctx, type, err, node_id, channel_id, value, size );
+    if( !_znet_event_has_cb( cb, type ) )
+        return;
+
+    switch( type )
+    {
+#if ZNET_CFG_CC_CONFIGURATION
+    case ZNET_EVENT_CONFIGURATION:
+    case ZNET_EVENT_CONFIGURATION_SET:
+        cb->node_cmd_configuration_result( err, node_id, channel_id, value,
+                                           cb->arg );
+        break;
+    case ZNET_EVENT_CONFIGURATION_BULK:
+    case ZNET_EVENT_CONFIGURATION_BULK_SET:
+        cb->node_cmd_configuration_bulk_result( err, node_id, channel_id, value,
+                                                cb->arg );
+        break;
+    case ZNET_EVENT_CONFIGURATION_BULK_VALUES:
+        cb->node_cmd_configuration_bulk_values_result( err, node_id, channel_id,
+                                                       value, cb->arg );
+        break;
+    case ZNET_EVENT_CONFIGURATION_NAME:
+        cb->node_cmd_configuration_name_result( err, node_id, channel_id, value,
+                                                cb->arg );
+        break;
+    case ZNET_EVENT_CONFIGURATION_INFO:
+        cb->node_cmd_configuration_info_result( err, node_id, channel_id, value,
+                                                cb->arg );
+        break;
+    case ZNET_EVENT_CONFIGURATION_PROPERTIES:
+        cb->node_cmd_configuration_properties_result( err, node_id, channel_id,
+                                                      value, cb->arg );
+        break;
+    case ZNET_EVENT_CONFIGURATION_WALK:
+        cb->node_cmd_configuration_walk_result( err, node_id, channel_id, value,
+                                                cb->arg );
+        break;
+    case ZNET_EVENT_CONFIGURATION_BACKUP:
+        cb->node_cmd_configuration_backup_result( err, node_id, channel_id,
+                                                  value, cb->arg );
+        break;
+    case ZNET_EVENT_CONFIGURATION_RESTORE:
+        cb->node_cmd_configuration_restore_result( err, node_id, channel_id,
+                                                   value, cb->arg );
+        break;
+#endif
+    case ZNET_EVENT_NODE_HEALTH:
+        cb->node_health_result( err, node_id, value, cb->arg );
+        break;
+    case ZNET_EVENT_NODE_INTERVIEW:
+        cb->node_interview_result( err, node_id, value, cb->arg );
+        break;
+    default:
+        break;
+    }
+}
+
+static struct znet_event_t* _znet_event_acquire( znet_dispatch_t* d )
+{
+    for( size_t i = 0; i < ZNET_DISPATCH_POOL; i++ )
+    {
+        uint_fast8_t expected = 0;
+        if( atomic_compare_exchange_strong( &d->events[i].busy, &expected, 1 ) )
+            return &d->events[i];
+    }
+    return NULL;
+}
+
+static void _znet_event_release( znet_dispatch_t* d, struct znet_event_t* event )
+{
+    atomic_fetch_sub( &d->pending, 1 );
+    atomic_store_explicit( &event->busy, 0, memory_order_release );
+}
+
+/// INFO: memory of the context is not thread safe, the buffer of a big report
+/// is allocated and released only by the thread of znet_proc
+static void _znet_event_big_free( znet_ctx_t* ctx, struct znet_event_t* event )
+{
+    if( !event->big )
+        return;
+    znet_mem_alloc( ctx, ZNET_MEM_TAG_DISPATCH, event->big, 0 );
+    event->big = NULL;
+}
+
+void znet_dispatch_init( znet_ctx_t* ctx )
+{
+    znet_dispatch_t* d = &ctx->dispatch;
+
+    d->mode = ZNET_DISPATCH_MODE_INLINE;
+    d->full_policy = ZNET_DISPATCH_FULL_DROP;
+    for( size_t i = 0; i < ZNET_DISPATCH_POOL; i++ )
+    {
+        atomic_init( &d->events[i].busy, 0 );
+        d->events[i].big = NULL;
+        d->events[i].ctx = ctx;
+    }
+    atomic_init( &d->head, 0 );
+    atomic_init( &d->tail, 0 );
+    atomic_init( &d->pending, 0 );
+    atomic_init( &d->queued, 0 );
+    atomic_init( &d->delivered, 0 );
+    atomic_init( &d->inlined, 0 );
+    atomic_init( &d->overflow, 0 );
+    atomic_init( &d->high_water, 0 );
+}
+
+void znet_dispatch( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+                    const void* value, size_t size )
+{
+    assert( ctx );
+
+    znet_dispatch_t* d = &ctx->dispatch;
+    if( !_znet_event_has_cb( ctx->cb, type ) && !znet_subscribe_any( ctx, type ) )
+        return;
+
+    if( d->mode == ZNET_DISPATCH_MODE_INLINE )
+    {
+        _znet_event_call( ctx, type, err, node_id, channel_id, value, size );
+        return;
+    }
+
+    struct znet_event_t* event = _znet_event_acquire( d );
+    if( event )
+    {
+        _znet_event_big_free( ctx, event );
+        if( value && size > ZNET_DISPATCH_PAYLOAD_MAX )
+        {
+            event->big = znet_mem_alloc( ctx, ZNET_MEM_TAG_DISPATCH, NULL, size );
+            if( !event->big )
+            {
+                atomic_store_explicit( &event->busy, 0, memory_order_release );
+                event = NULL;
+            }
+        }
+    }
+
+    /// INFO: the callback never runs on the thread of znet_proc unless allowed
+    if( !event )
+    {
+        if( d->full_policy == ZNET_DISPATCH_FULL_INLINE )
+        {
+            atomic_fetch_add( &d->inlined, 1 );
+            _znet_event_call( ctx, type, err, node_id, channel_id, value, size );
+        }
+        else
+        {
+            atomic_fetch_add( &d->overflow, 1 );
+            if( size > ZNET_DISPATCH_PAYLOAD_MAX )
+                ZNET_LOGW( "ZNET: No memory for report of %zu bytes, "
+                           "event %d dropped!\n", size, type );
+            else
+                ZNET_LOGW( "ZNET: Event pool is full, event %d dropped!\n", type );
+        }
+        return;
+    }
+
+    event->type = type;
+    event->err = err;
+    event->node_id = node_id;
+    event->channel_id = channel_id;
+    event->size = value ? size : 0;
+    if( event->size )
+        memcpy( event->big ? event->big : event->data, value, size );
+
+    uint_fast32_t pending = atomic_fetch_add( &d->pending, 1 ) + 1;
+    if( pending > atomic_load( &d->high_water ) )
+        atomic_store( &d->high_water, pending );
+    atomic_fetch_add( &d->queued, 1 );
+
+    if( d->mode == ZNET_DISPATCH_MODE_EXECUTOR )
+    {
+        ctx->cb->dispatch_executor( event, ctx->cb->arg );
+        return;
+    }
+
+    size_t tail = atomic_load_explicit( &d->tail, memory_order_relaxed );
+    d->ring[tail & ( ZNET_DISPATCH_POOL - 1 )] = (uint8_t)( event - d->events );
+    atomic_store_explicit( &d->tail, tail + 1, memory_order_release );
+}
+
+void znet_event_run( znet_event_t* event )
+{
+    assert( event );
+
+    znet_ctx_t* ctx = event->ctx;
+    znet_dispatch_t* d = &ctx->dispatch;
+
+    _znet_event_call( ctx, event->type, event->err, event->node_id,
+                      event->channel_id,
+                      !event->size ? NULL : event->big ? event->big : event->data,
+                      event->size );
+    atomic_fetch_add( &d->delivered, 1 );
+    _znet_event_release( d, event );
+}
+
+void znet_dispatch_proc( znet_ctx_t* ctx )
+{
+    znet_dispatch_t* d = &ctx->dispatch;
+    for( size_t i = 0; i < ZNET_DISPATCH_POOL; i++ )
+    {
+        struct znet_event_t* event = &d->events[i];
+        if( event->big &&
+            !atomic_load_explicit( &event->busy, memory_order_acquire ) )
+            _znet_event_big_free( ctx, event );
+    }
+}
+
+void znet_dispatch_free( znet_ctx_t* ctx )
+{
+    znet_dispatch_t* d = &ctx->dispatch;
+    for( size_t i = 0; i < ZNET_DISPATCH_POOL; i++ )
+        _znet_event_big_free( ctx, &d->events[i] );
+}
+
+int znet_ctx_dispatch_mode( znet_ctx_t* ctx, int mode, int full_policy )
+{
+    if( !ctx )
+        return -1;
+
+    if( mode == ZNET_DISPATCH_MODE_EXECUTOR && !ctx->cb->dispatch_executor )
+    {
+        ZNET_LOGE( "ZNET: Executor is not set!\n" );
+        return -1;
+    }
+
+    if( mode != ZNET_DISPATCH_MODE_INLINE &&
+        mode != ZNET_DISPATCH_MODE_EXECUTOR && mode != ZNET_DISPATCH_MODE_QUEUE )
+        return -1;
+
+    if( atomic_load( &ctx->dispatch.pending ) )
+    {
+        ZNET_LOGE( "ZNET: Events are pending, mode is not changed!\n" );
+        return -1;
+    }
+
+    ctx->dispatch.mode = mode;
+    ctx->dispatch.full_policy = full_policy;
+    return 0;
+}
+
+size_t znet_ctx_dispatch_drain( znet_ctx_t* ctx, size_t max )
+{
+    assert( ctx );
+
+    znet_dispatch_t* d = &ctx->dispatch;
+    size_t head = atomic_load_explicit( &d->head, memory_order_relaxed );
+    size_t tail = atomic_load_explicit( &d->tail, memory_order_acquire );
+    size_t count = 0;
+
+    while( head != tail && count < max )
+    {
+        uint8_t index = d->ring[head & ( ZNET_DISPATCH_POOL - 1 )];
+        atomic_store_explicit( &d->head, ++head, memory_order_release );
+        znet_event_run( &d->events[index] );
+        count++;
+    }
+    return count;
+}
+
+void znet_ctx_dispatch_stats( znet_ctx_t* ctx, znet_dispatch_stats_t* stats )
+{
+    assert( ctx );
+    assert( stats );
+
+    znet_dispatch_t* d = &ctx->dispatch;
+    stats->pending = atomic_load( &d->pending );
+    stats->queued = atomic_load( &d->queued );
+    stats->delivered = atomic_load( &d->delivered );
+    stats->inlined = atomic_load( &d->inlined );
+    stats->overflow = atomic_load( &d->overflow );
+    stats->high_water = atomic_load( &d->high_water );
+}
@@ -0,0 +1,133 @@
+/**
+ * @file znet_dispatch.h
+ * @date 18 Oct 2026
+ * @brief Delivery of results/reports to the user callbacks.
+ */
+
+#ifndef ZNET_DISPATCH_H
+#define ZNET_DISPATCH_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of pooled events (power of 2)
+ */
+#define ZNET_DISPATCH_POOL 32
+
+/**
+ * @brief Max size of report copied into event. A bigger report is copied into
+ * a buffer owned by the event.
+ */
+#define ZNET_DISPATCH_PAYLOAD_MAX 192
+
+/**
+ * @brief Event type, selects the user callback
+ */
+typedef enum znet_event_type_t {
+    ZNET_EVENT_NONE = 0,
+#if ZNET_CFG_CC_CONFIGURATION
+    ZNET_EVENT_CONFIGURATION,
+    ZNET_EVENT_CONFIGURATION_SET,
+    ZNET_EVENT_CONFIGURATION_BULK,
+    ZNET_EVENT_CONFIGURATION_BULK_SET,
+    ZNET_EVENT_CONFIGURATION_BULK_VALUES,
+    ZNET_EVENT_CONFIGURATION_NAME,
+    ZNET_EVENT_CONFIGURATION_INFO,
+    ZNET_EVENT_CONFIGURATION_PROPERTIES,
+    ZNET_EVENT_CONFIGURATION_WALK,
+    ZNET_EVENT_CONFIGURATION_BACKUP,
+    ZNET_EVENT_CONFIGURATION_RESTORE,
+#endif
+    ZNET_EVENT_NODE_HEALTH,
+    ZNET_EVENT_NODE_INTERVIEW,
+
+    ZNET_EVENT_COUNT /**< Number of event types, keep last */
+} znet_event_type_t;
+
+/**
+ * @brief Pooled event: copy of the report for deferred delivery
+ */
+struct znet_event_t
+{
+    atomic_uint_fast8_t busy;          /**< flag: taken from the pool */
+    uint8_t type;                      /**< Event type */
+    znet_node_id_t node_id;            /**< Node ID */
+    znet_node_channel_id_t channel_id; /**< Channel ID */
+    int err;                           /**< Result */
+    znet_ctx_t* ctx;                   /**< Owner */
+    size_t size;                       /**< Size of report, 0 - no report */
+    void* big;                         /**< Report over the payload size,
+                                            released by the thread of
+                                            znet_proc once the event is free */
+    _Alignas( 8 ) uint8_t data[ZNET_DISPATCH_PAYLOAD_MAX]; /**< Report */
+};
+
+/**
+ * @brief Dispatcher state of the context
+ */
+typedef struct znet_dispatch_t
+{
+    int mode;        /**< ZNET_DISPATCH_MODE_* */
+    int full_policy; /**< ZNET_DISPATCH_FULL_* */
+
+    struct znet_event_t events[ZNET_DISPATCH_POOL]; /**< Event pool */
+
+    /// INFO: SPSC queue, can not overflow - holds pool indexes only
+    uint8_t ring[ZNET_DISPATCH_POOL];
+    atomic_size_t head; /**< Consumer position */
+    atomic_size_t tail; /**< Producer position */
+
+    atomic_uint_fast32_t pending;
+    atomic_uint_fast32_t queued;
+    atomic_uint_fast32_t delivered;
+    atomic_uint_fast32_t inlined;
+    atomic_uint_fast32_t overflow;
+    atomic_uint_fast32_t high_water;
+} znet_dispatch_t;
+
+/**
+ * @brief Init dispatcher state (inline mode)
+ */
+void znet_dispatch_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Deliver result/report to the user callback
+ *
+ * Depending on the mode the callback is called inline or the report is
+ * copied into a pooled event and delivered later.
+ *
+ * @param ctx Context
+ * @param type Event type
+ * @param err Result
+ * @param node_id Node ID
+ * @param channel_id Channel ID
+ * @param value Report, may be NULL
+ * @param size Size of the report
+ */
+void znet_dispatch( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+                    const void* value, size_t size );
+
+/**
+ * @brief Release buffers of big reports of delivered events
+ */
+void znet_dispatch_proc( znet_ctx_t* ctx );
+
+/**
+ * @brief Release buffers of big reports, nothing is pending anymore
+ */
+void znet_dispatch_free( znet_ctx_t* ctx );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_DISPATCH_H
@@ -0,0 +1,222 @@
+/**
+ * @file znet_dispatch_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of queued delivery of results.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_dispatch_test.c -o znet_dispatch_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_dispatch.c"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+#define TEST_NODE 5
+#define TEST_WALK_PARAMS 4
+
+static struct
+{
+    size_t live;       /**< Blocks not released */
+    int no_memory;     /**< flag: allocation fails */
+    size_t results;
+    int last_value;
+    size_t walks;
+    uint16_t walk_count;
+    uint8_t walk_name_last;
+} test;
+
+void znet_subscribe_notify( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                            znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            const void* value, size_t size )
+{
+    (void)ctx;
+    (void)type;
+    (void)err;
+    (void)node_id;
+    (void)channel_id;
+    (void)value;
+    (void)size;
+}
+
+int znet_subscribe_any( znet_ctx_t* ctx, znet_event_type_t type )
+{
+    (void)ctx;
+    (void)type;
+    return 0;
+}
+
+void* znet_mem_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag, void* ptr, size_t size )
+{
+    (void)ctx;
+    assert( tag == ZNET_MEM_TAG_DISPATCH );
+    if( !size )
+    {
+        assert( ptr && test.live );
+        test.live--;
+        free( ptr );
+        return NULL;
+    }
+    if( test.no_memory )
+        return NULL;
+    assert( !ptr );
+    test.live++;
+    return malloc( size );
+}
+
+static void _test_result( int err, znet_node_id_t node_id,
+                          znet_node_channel_id_t channel_id,
+                          const znet_configuration_report_t* value, void* arg )
+{
+    (void)err;
+    (void)node_id;
+    (void)channel_id;
+    (void)arg;
+    test.results++;
+    test.last_value = (int)value->value;
+}
+
+static void _test_walk( int err, znet_node_id_t node_id,
+                        znet_node_channel_id_t channel_id,
+                        const znet_configuration_walk_report_t* value, void* arg )
+{
+    (void)err;
+    (void)node_id;
+    (void)channel_id;
+    (void)arg;
+    test.walks++;
+    test.walk_count = value->count;
+    test.walk_name_last = (uint8_t)value->params[value->count - 1].name[0];
+}
+
+static const znet_callbacks_t _test_cb = {
+    .node_cmd_configuration_result = _test_result,
+    .node_cmd_configuration_walk_result = _test_walk };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_dispatch_init( &_test_ctx );
+    assert( !znet_ctx_dispatch_mode( &_test_ctx, ZNET_DISPATCH_MODE_QUEUE,
+                                     ZNET_DISPATCH_FULL_DROP ) );
+    return &_test_ctx;
+}
+
+static void _test_report( znet_ctx_t* ctx, int value )
+{
+    znet_configuration_report_t report = { .param_number = 1, .data_count = 4,
+                                           .value = (uint32_t)value };
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION, 0, TEST_NODE,
+                   ZNET_CHANNEL_ID_ROOT, &report, sizeof( report ) );
+}
+
+/// INFO: events come out in order across the wrap of the ring
+static void _test_order( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    for( int i = 0; i < 5 * ZNET_DISPATCH_POOL; i++ )
+    {
+        _test_report( ctx, i );
+        _test_report( ctx, i + 1000 );
+        assert( znet_ctx_dispatch_drain( ctx, 1 ) == 1 );
+        assert( test.last_value == i );
+        assert( znet_ctx_dispatch_drain( ctx, 8 ) == 1 );
+        assert( test.last_value == i + 1000 );
+    }
+
+    znet_dispatch_stats_t stats;
+    znet_ctx_dispatch_stats( ctx, &stats );
+    assert( stats.pending == 0 && stats.delivered == 10 * ZNET_DISPATCH_POOL );
+    assert( stats.overflow == 0 && stats.high_water == 2 );
+}
+
+/// INFO: a full pool drops the report and counts it
+static void _test_full( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    for( int i = 0; i <= ZNET_DISPATCH_POOL; i++ )
+        _test_report( ctx, i );
+    assert( znet_ctx_dispatch_drain( ctx, SIZE_MAX ) == ZNET_DISPATCH_POOL );
+    assert( test.last_value == ZNET_DISPATCH_POOL - 1 );
+
+    znet_dispatch_stats_t stats;
+    znet_ctx_dispatch_stats( ctx, &stats );
+    assert( stats.overflow == 1 );
+}
+
+/// INFO: a report over the payload size goes in a buffer of its event, it is
+/// released after delivery
+static void _test_big( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+
+    size_t size = sizeof( znet_configuration_walk_report_t ) +
+                  TEST_WALK_PARAMS * sizeof( znet_param_meta_t );
+    assert( size > ZNET_DISPATCH_PAYLOAD_MAX );
+    znet_configuration_walk_report_t* walk = calloc( 1, size );
+    walk->count = TEST_WALK_PARAMS;
+    walk->params[TEST_WALK_PARAMS - 1].name[0] = 'x';
+
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_WALK, 0, TEST_NODE,
+                   ZNET_CHANNEL_ID_ROOT, walk, size );
+    memset( walk, 0, size );
+    assert( test.live == 1 );
+
+    /// INFO: not released before it is delivered
+    znet_dispatch_proc( ctx );
+    assert( test.live == 1 );
+
+    assert( znet_ctx_dispatch_drain( ctx, SIZE_MAX ) == 1 );
+    assert( test.walks == 1 && test.walk_count == TEST_WALK_PARAMS );
+    assert( test.walk_name_last == 'x' );
+    znet_dispatch_proc( ctx );
+    assert( test.live == 0 );
+
+    /// INFO: without memory it is handled as a full pool
+    walk->count = TEST_WALK_PARAMS;
+    test.no_memory = 1;
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_WALK, 0, TEST_NODE,
+                   ZNET_CHANNEL_ID_ROOT, walk, size );
+    assert( znet_ctx_dispatch_drain( ctx, SIZE_MAX ) == 0 );
+
+    znet_dispatch_stats_t stats;
+    znet_ctx_dispatch_stats( ctx, &stats );
+    assert( stats.overflow == 1 && stats.pending == 0 );
+
+    /// INFO: a queued big report is released with the context
+    test.no_memory = 0;
+    znet_dispatch( ctx, ZNET_EVENT_CONFIGURATION_WALK, 0, TEST_NODE,
+                   ZNET_CHANNEL_ID_ROOT, walk, size );
+    assert( test.live == 1 );
+    znet_dispatch_free( ctx );
+    assert( test.live == 0 );
+    free( walk );
+}
+
+int main( void )
+{
+    _test_order();
+    _test_full();
+    _test_big();
+    printf( "znet_dispatch_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
@@ -0,0 +1,211 @@
+/**
+ * @file znet_health.c
+ * @date 18 Oct 2026
+ * @brief Health of nodes: failed nodes, fast-fail and probes.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_health.h"
+#include "znet_dispatch.h"
+#include "znet_airtime.h"
+
+static znet_health_t* _znet_health_node( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
+        return NULL;
+    return &ctx->health.nodes[node_id];
+}
+
+static void _znet_health_export( const znet_health_t* it,
+                                 znet_node_health_t* health )
+{
+    health->failed = it->failed;
+    health->failures = it->failures;
+    health->last_contact = it->last_contact;
+    health->next_probe = it->next_probe;
+    health->rejected = it->rejected;
+}
+
+static void _znet_health_notify( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                 const znet_health_t* it )
+{
+    znet_node_health_t health;
+    _znet_health_export( it, &health );
+    znet_dispatch( ctx, ZNET_EVENT_NODE_HEALTH, 0, node_id,
+                   ZNET_CHANNEL_ID_ROOT, &health, sizeof( health ) );
+}
+
+/// INFO: interval doubles on every probe without report
+static uint32_t _znet_health_interval( const znet_health_table_t* table,
+                                       const znet_health_t* it )
+{
+    uint64_t interval = (uint64_t)table->probe_ms << it->backoff;
+    if( interval > table->probe_max_ms )
+        interval = table->probe_max_ms;
+    return (uint32_t)interval;
+}
+
+void znet_health_init( znet_ctx_t* ctx )
+{
+    znet_health_table_t* table = &ctx->health;
+
+    memset( table, 0, sizeof( znet_health_table_t ) );
+    table->threshold = ZNET_HEALTH_THRESHOLD;
+    table->probe_ms = ZNET_HEALTH_PROBE_MS;
+    table->probe_max_ms = ZNET_HEALTH_PROBE_MAX_MS;
+}
+
+void znet_health_proc( znet_ctx_t* ctx )
+{
+#if ZNET_CFG_CC_VERSION
+    /// INFO: command modules without context API serve the default context
+    /// only; lowest priority, normal traffic goes first
+    znet_health_table_t* table = &ctx->health;
+    if( !table->threshold || ctx != znet_ctx_default || ctx->deferred.throttled )
+        return;
+
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    for( size_t id = ZNET_NODE_ID_MIN; id <= ZNET_NODE_ID_MAX; id++ )
+    {
+        znet_health_t* it = &table->nodes[id];
+        if( !it->failed || now < it->next_probe )
+            continue;
+#if ZNET_CFG_CC_WAKE_UP
+        /// INFO: a sleeping node reports itself at wake up
+        if( ctx->deferred.sleeping[id] )
+            continue;
+#endif
+        if( !znet_airtime_admit( ctx, (znet_node_id_t)id,
+                                 ZNET_HEALTH_PROBE_PAYLOAD ) )
+            return;
+
+        /// INFO: the next probe is scheduled by the admit
+        if( znet_health_admit( ctx, (znet_node_id_t)id, 1 ) )
+            znet_node_cmd_version_get( (znet_node_id_t)id );
+        return;
+    }
+#else
+    (void)ctx;
+#endif
+}
+
+void znet_health_contact( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    znet_health_t* it = _znet_health_node( ctx, node_id );
+    if( !it )
+        return;
+
+    it->last_contact = ctx->cb->clock( ctx->cb->arg );
+    it->failures = 0;
+    it->backoff = 0;
+    if( !it->failed )
+        return;
+
+    it->failed = 0;
+    ZNET_LOGI( "ZNET: Node %u recovered, %u commands were rejected\n",
+               node_id, it->rejected );
+    _znet_health_notify( ctx, node_id, it );
+}
+
+void znet_health_loss( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    znet_health_table_t* table = &ctx->health;
+    znet_health_t* it = _znet_health_node( ctx, node_id );
+    if( !it )
+        return;
+
+    if( it->failures < UINT8_MAX )
+        it->failures++;
+    if( it->failed || !table->threshold || it->failures < table->threshold )
+        return;
+
+    it->failed = 1;
+    it->rejected = 0;
+    it->next_probe = ctx->cb->clock( ctx->cb->arg ) + table->probe_ms;
+    ZNET_LOGW( "ZNET: Node %u failed after %u lost reports\n",
+               node_id, it->failures );
+    _znet_health_notify( ctx, node_id, it );
+}
+
+int znet_health_admit( znet_ctx_t* ctx, znet_node_id_t node_id, int probe )
+{
+    znet_health_table_t* table = &ctx->health;
+    znet_health_t* it = _znet_health_node( ctx, node_id );
+    if( !it || !it->failed )
+        return 1;
+
+    if( probe )
+    {
+        uint64_t now = ctx->cb->clock( ctx->cb->arg );
+        if( now >= it->next_probe )
+        {
+            ZNET_LOGD( "ZNET: Probe of failed node %u\n", node_id );
+            if( it->backoff < 31 )
+                it->backoff++;
+            it->next_probe = now + _znet_health_interval( table, it );
+            return 1;
+        }
+    }
+
+    it->rejected++;
+    return 0;
+}
+
+int znet_ctx_health_config( znet_ctx_t* ctx, uint8_t fail_threshold,
+                            uint32_t probe_ms, uint32_t probe_max_ms )
+{
+    if( !ctx || !probe_ms || probe_max_ms < probe_ms )
+        return -1;
+
+    znet_health_table_t* table = &ctx->health;
+    table->threshold = fail_threshold;
+    table->probe_ms = probe_ms;
+    table->probe_max_ms = probe_max_ms;
+
+    /// INFO: detection is off, nothing is rejected any more
+    if( !fail_threshold )
+        for( size_t i = 0; i <= ZNET_NODE_ID_MAX; i++ )
+            table->nodes[i].failed = 0;
+    return 0;
+}
+
+int znet_ctx_node_health( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          znet_node_health_t* health )
+{
+    if( !ctx || !health )
+        return -1;
+
+    const znet_health_t* it = _znet_health_node( ctx, node_id );
+    if( !it )
+        return -1;
+
+    _znet_health_export( it, health );
+    return 0;
+}
+
+int znet_ctx_node_health_reset( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    if( !ctx )
+        return -1;
+
+    znet_health_t* it = _znet_health_node( ctx, node_id );
+    if( !it )
+        return -1;
+
+    int failed = it->failed;
+    it->failed = 0;
+    it->failures = 0;
+    it->backoff = 0;
+    if( failed )
+        _znet_health_notify( ctx, node_id, it );
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file znet_health.h
+ * @date 18 Oct 2026
+ * @brief Health of nodes: failed nodes, fast-fail and probes.
+ */
+
+#ifndef ZNET_HEALTH_H
+#define ZNET_HEALTH_H
+
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Default lost reports in a row after which node is failed
+ */
+#define ZNET_HEALTH_THRESHOLD 3
+
+/**
+ * @brief Default probe interval of failed node and its max after backoff (ms)
+ */
+#define ZNET_HEALTH_PROBE_MS 60000
+#define ZNET_HEALTH_PROBE_MAX_MS 900000
+
+/**
+ * @brief Payload of probe GET used to ask for airtime (bytes)
+ */
+#define ZNET_HEALTH_PROBE_PAYLOAD 2
+
+/**
+ * @brief Health of one node
+ */
+typedef struct znet_health_t
+{
+    uint8_t failed;        /**< flag: node is failed */
+    uint8_t failures;      /**< Lost reports in a row */
+    uint8_t backoff;       /**< Probes without report */
+    uint64_t last_contact; /**< Time of last report (ms), 0 - never */
+    uint64_t next_probe;   /**< Time of next probe (ms) */
+    uint32_t rejected;     /**< Commands rejected while failed */
+} znet_health_t;
+
+/**
+ * @brief Health of all nodes of the context
+ */
+typedef struct znet_health_table_t
+{
+    uint8_t threshold;     /**< Lost reports in a row, 0 - off */
+    uint32_t probe_ms;     /**< First probe interval */
+    uint32_t probe_max_ms; /**< Max probe interval */
+    znet_health_t nodes[ZNET_NODE_ID_MAX + 1];
+} znet_health_table_t;
+
+/**
+ * @brief Init all nodes as healthy with default settings
+ */
+void znet_health_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Probe a failed node when its probe is due and airtime is idle
+ *
+ * The probe is a Version Get, so a node recovers even if the application
+ * sends it nothing. One probe per call.
+ */
+void znet_health_proc( znet_ctx_t* ctx );
+
+/**
+ * @brief Node sent a report: reset failures, recover failed node
+ */
+void znet_health_contact( znet_ctx_t* ctx, znet_node_id_t node_id );
+
+/**
+ * @brief Report of node was lost, mark node as failed at the threshold
+ */
+void znet_health_loss( znet_ctx_t* ctx, znet_node_id_t node_id );
+
+/**
+ * @brief Check that command may be sent to node
+ *
+ * A command to failed node is rejected unless it may serve as probe and the
+ * probe is due. The next probe is scheduled then.
+ *
+ * @param probe Command may serve as probe: GET, and nothing waits for airtime
+ * @return 1 - send, 0 - reject
+ */
+int znet_health_admit( znet_ctx_t* ctx, znet_node_id_t node_id, int probe );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_HEALTH_H
@@ -0,0 +1,157 @@
+/**
+ * @file znet_health_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of failed nodes and their probes.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_health_test.c -o znet_health_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_health.c"
+
+#if ZNET_CFG_CC_VERSION
+
+#define TEST_NODE 5
+#define TEST_PROBE_MS 1000
+
+static struct
+{
+    uint64_t now;
+    int busy;                /**< flag: airtime is not admitted */
+    size_t probes;           /**< Version Gets sent */
+    znet_node_id_t probed;   /**< Node of last probe */
+    size_t notified;         /**< Health events */
+    znet_node_health_t last; /**< Last health event */
+} test;
+
+znet_ctx_t* znet_ctx_default;
+
+void znet_node_cmd_version_get( znet_node_id_t node_id )
+{
+    test.probes++;
+    test.probed = node_id;
+}
+
+int znet_airtime_admit( znet_ctx_t* ctx, znet_node_id_t node_id, size_t payload )
+{
+    (void)ctx;
+    (void)node_id;
+    assert( payload == ZNET_HEALTH_PROBE_PAYLOAD );
+    return !test.busy;
+}
+
+void znet_dispatch( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+                    const void* value, size_t size )
+{
+    (void)ctx;
+    (void)err;
+    (void)channel_id;
+    assert( type == ZNET_EVENT_NODE_HEALTH && node_id == TEST_NODE );
+    assert( size == sizeof( znet_node_health_t ) );
+    memcpy( &test.last, value, size );
+    test.notified++;
+}
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return test.now;
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_ctx_default = &_test_ctx;
+    znet_health_init( &_test_ctx );
+    assert( !znet_ctx_health_config( &_test_ctx, 2, TEST_PROBE_MS,
+                                     4 * TEST_PROBE_MS ) );
+    test.now = 1000000;
+
+    znet_health_loss( &_test_ctx, TEST_NODE );
+    znet_health_loss( &_test_ctx, TEST_NODE );
+    assert( test.notified == 1 && test.last.failed );
+    return &_test_ctx;
+}
+
+/// INFO: the library probes a failed node on its own, with backoff
+static void _test_probe( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_health_proc( ctx );
+    assert( test.probes == 0 );
+
+    test.now += TEST_PROBE_MS;
+    znet_health_proc( ctx );
+    assert( test.probes == 1 && test.probed == TEST_NODE );
+    znet_health_proc( ctx );
+    assert( test.probes == 1 );
+
+    /// INFO: no report, the next probe comes after twice the interval
+    test.now += TEST_PROBE_MS;
+    znet_health_proc( ctx );
+    assert( test.probes == 1 );
+    test.now += TEST_PROBE_MS;
+    znet_health_proc( ctx );
+    assert( test.probes == 2 );
+
+    /// INFO: the report of the probe recovers the node
+    znet_health_contact( ctx, TEST_NODE );
+    assert( test.notified == 2 && !test.last.failed );
+    test.now += 10 * TEST_PROBE_MS;
+    znet_health_proc( ctx );
+    assert( test.probes == 2 );
+    assert( znet_health_admit( ctx, TEST_NODE, 0 ) );
+}
+
+/// INFO: normal traffic goes first, the probe waits for it
+static void _test_probe_waits( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    test.now += TEST_PROBE_MS;
+
+    test.busy = 1;
+    znet_health_proc( ctx );
+    ctx->deferred.throttled = 1;
+    test.busy = 0;
+    znet_health_proc( ctx );
+    assert( test.probes == 0 );
+
+    ctx->deferred.throttled = 0;
+    znet_health_proc( ctx );
+    assert( test.probes == 1 );
+
+    /// INFO: a GET of the application took the probe
+    test.now += 2 * TEST_PROBE_MS;
+    assert( znet_health_admit( ctx, TEST_NODE, 1 ) );
+    znet_health_proc( ctx );
+    assert( test.probes == 1 );
+}
+
+int main( void )
+{
+    _test_probe();
+    _test_probe_waits();
+    printf( "znet_health_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_VERSION
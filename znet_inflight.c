@@ -0,0 +1,243 @@
+/**
+ * @file znet_inflight.c
+ * @date 18 Oct 2026
+ * @brief Outstanding GET requests: deduplication and result fan-out.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_inflight.h"
+#include "znet_cmd_configuration.h"
+#include "znet_rtt.h"
+#include "znet_airtime.h"
+#include "znet_health.h"
+
+static znet_inflight_t* _znet_inflight_find( znet_ctx_t* ctx,
+                                             znet_node_id_t node_id,
+                                             znet_node_channel_id_t channel_id,
+                                             znet_command_class_t command,
+                                             uint16_t param )
+{
+    for( size_t i = 0; i < ZNET_INFLIGHT_MAX; i++ )
+    {
+        znet_inflight_t* it = &ctx->inflight[i];
+        if( it->node_id != ZNET_NODE_ID_INVALID && it->node_id == node_id &&
+            it->channel_id == channel_id && it->command == command &&
+            it->param == param )
+            return it;
+    }
+    return NULL;
+}
+
+/// INFO: a GET waits for the result of its transmit first, the stack always
+/// reports it and matches it by the order of transmits
+static int _znet_inflight_timed_out( const znet_inflight_t* it, uint64_t now )
+{
+    return it->node_id != ZNET_NODE_ID_INVALID && !it->tx_seq &&
+           now - it->tx_time > it->timeout;
+}
+
+/// INFO: order numbers of transmits without result are kept in 1..count, so
+/// the next one never wraps to 0 (transmit done)
+static uint8_t _znet_inflight_renumber( znet_ctx_t* ctx )
+{
+    uint8_t last = 0;
+    uint8_t seq = 0;
+    for( ;; )
+    {
+        znet_inflight_t* next = NULL;
+        for( size_t i = 0; i < ZNET_INFLIGHT_MAX; i++ )
+        {
+            znet_inflight_t* it = &ctx->inflight[i];
+            if( it->node_id != ZNET_NODE_ID_INVALID && it->tx_seq > last &&
+                ( !next || it->tx_seq < next->tx_seq ) )
+                next = it;
+        }
+        if( !next )
+            return seq;
+
+        last = next->tx_seq;
+        next->tx_seq = ++seq;
+    }
+}
+
+/// INFO: report is lost, waiters get an error, next caller transmits again
+static void _znet_inflight_expire( znet_ctx_t* ctx, znet_inflight_t* it,
+                                   uint64_t now )
+{
+    if( it->expired )
+    {
+        it->node_id = ZNET_NODE_ID_INVALID;
+        return;
+    }
+
+    ZNET_LOGD( "ZNET: GET 0x%02X:%u for node %u expired\n",
+               it->command, it->param, it->node_id );
+
+    znet_node_id_t node_id = it->node_id;
+    znet_node_channel_id_t channel_id = it->channel_id;
+    uint8_t waiters = it->waiters;
+    znet_rtt_loss( ctx, it->node_id );
+    znet_airtime_failure( ctx );
+    znet_health_loss( ctx, it->node_id );
+
+    /// INFO: the report may still come, it must not look like a success
+    it->expired = 1;
+    it->waiters = 0;
+    it->tx_time = now;
+
+#if ZNET_CFG_CC_CONFIGURATION
+    if( it->command == ZNET_COMMAND_CLASS_CONFIGURATION )
+        znet_configuration_get_failed( ctx, node_id, channel_id,
+                                       (uint8_t)it->param, waiters );
+#else
+    (void)node_id;
+    (void)channel_id;
+    (void)waiters;
+#endif
+}
+
+int znet_inflight_attach( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          znet_node_channel_id_t channel_id,
+                          znet_command_class_t command, uint16_t param,
+                          uint8_t waiters )
+{
+    assert( ctx );
+    assert( waiters );
+
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    znet_inflight_t* free_slot = NULL;
+    for( size_t i = 0; i < ZNET_INFLIGHT_MAX; i++ )
+    {
+        znet_inflight_t* it = &ctx->inflight[i];
+        if( _znet_inflight_timed_out( it, now ) )
+            _znet_inflight_expire( ctx, it, now );
+
+        if( it->node_id == ZNET_NODE_ID_INVALID )
+        {
+            if( !free_slot || free_slot->expired )
+                free_slot = it;
+            continue;
+        }
+
+        int same = it->node_id == node_id && it->channel_id == channel_id &&
+                   it->command == command && it->param == param;
+        if( it->expired )
+        {
+            /// INFO: new GET of the key takes its marker, else it is reused
+            /// only if no slot is free
+            if( same || !free_slot )
+                free_slot = it;
+            if( same )
+                break;
+            continue;
+        }
+
+        if( same && it->waiters <= UINT8_MAX - waiters )
+        {
+            it->waiters += waiters;
+            return 1;
+        }
+    }
+
+    if( !free_slot )
+        return -1;
+
+    /// INFO: marker of other key is dropped, its late report is delivered
+    free_slot->node_id = ZNET_NODE_ID_INVALID;
+
+    /// INFO: after the last transmit still waiting for its result
+    uint8_t tx_seq = 0;
+    for( size_t i = 0; i < ZNET_INFLIGHT_MAX; i++ )
+        if( ctx->inflight[i].node_id != ZNET_NODE_ID_INVALID &&
+            ctx->inflight[i].tx_seq > tx_seq )
+            tx_seq = ctx->inflight[i].tx_seq;
+    if( tx_seq == UINT8_MAX )
+        tx_seq = _znet_inflight_renumber( ctx );
+
+    free_slot->node_id = node_id;
+    free_slot->channel_id = channel_id;
+    free_slot->command = command;
+    free_slot->param = param;
+    free_slot->waiters = waiters;
+    free_slot->tx_time = now;
+    free_slot->timeout = znet_rtt_timeout( ctx, node_id );
+    free_slot->tx_seq = tx_seq + 1;
+    free_slot->expired = 0;
+    return 0;
+}
+
+int znet_inflight_complete( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            znet_command_class_t command, uint16_t param,
+                            int reported )
+{
+    znet_inflight_t* it =
+        _znet_inflight_find( ctx, node_id, channel_id, command, param );
+    if( !it )
+        return 0;
+
+    if( it->expired )
+    {
+        ZNET_LOGD( "ZNET: Late report 0x%02X:%u of node %u\n",
+                   command, param, node_id );
+        it->node_id = ZNET_NODE_ID_INVALID;
+        return -1;
+    }
+
+    if( reported )
+    {
+        uint64_t now = ctx->cb->clock( ctx->cb->arg );
+        znet_rtt_sample( ctx, node_id, (uint32_t)( now - it->tx_time ) );
+        znet_airtime_success( ctx );
+        znet_health_contact( ctx, node_id );
+    }
+
+    uint8_t waiters = it->waiters;
+    it->node_id = ZNET_NODE_ID_INVALID;
+    return waiters;
+}
+
+uint8_t znet_inflight_transmitted( znet_ctx_t* ctx,
+                                   znet_command_class_t command, int ok,
+                                   znet_inflight_t* entry )
+{
+    znet_inflight_t* first = NULL;
+    for( size_t i = 0; i < ZNET_INFLIGHT_MAX; i++ )
+    {
+        znet_inflight_t* it = &ctx->inflight[i];
+        if( it->node_id != ZNET_NODE_ID_INVALID && !it->expired &&
+            it->command == command && it->tx_seq && ( !first || it->tx_seq < first->tx_seq ) )
+            first = it;
+    }
+    if( !first )
+        return 0;
+
+    *entry = *first;
+    first->tx_seq = 0;
+    if( ok )
+        return 0;
+
+    uint8_t waiters = first->waiters;
+    first->node_id = ZNET_NODE_ID_INVALID;
+    return waiters;
+}
+
+void znet_inflight_proc( znet_ctx_t* ctx )
+{
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    for( size_t i = 0; i < ZNET_INFLIGHT_MAX; i++ )
+    {
+        znet_inflight_t* it = &ctx->inflight[i];
+        if( _znet_inflight_timed_out( it, now ) )
+            _znet_inflight_expire( ctx, it, now );
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file znet_inflight.h
+ * @date 18 Oct 2026
+ * @brief Outstanding GET requests: deduplication and result fan-out.
+ */
+
+#ifndef ZNET_INFLIGHT_H
+#define ZNET_INFLIGHT_H
+
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max number of GET requests tracked at the same time
+ */
+#define ZNET_INFLIGHT_MAX 16
+
+/**
+ * @brief Outstanding GET request
+ *
+ * A request is identified by node, channel, command class and a command
+ * class specific parameter:
+ * - Configuration: parameter number
+ * - Meter: scale
+ * - Multilevel switch: 0
+ */
+typedef struct znet_inflight_t
+{
+    znet_node_id_t node_id;            /**< Node ID, INVALID - free slot */
+    znet_node_channel_id_t channel_id; /**< Channel ID */
+    znet_command_class_t command;      /**< Command class */
+    uint8_t waiters;                   /**< Callers waiting for the report */
+    uint16_t param;                    /**< Command class specific key */
+    uint64_t tx_time;                  /**< Time of transmit (ms) */
+    uint32_t timeout;                  /**< Lost after, from RTT of node (ms) */
+    uint8_t tx_seq;                    /**< Order of transmit without result,
+                                            0 - transmit done, renumbered
+                                            before it wraps */
+    uint8_t expired;                   /**< flag: waiters got an error, kept
+                                            for one more timeout to catch the
+                                            late report */
+} znet_inflight_t;
+
+/**
+ * @brief Attach a caller to an identical outstanding GET or register a new one
+ *
+ * @param waiters Number of callers
+ * @return 1 - attached to outstanding GET, do not transmit
+ *         0 - registered as new GET, transmit it
+ *        -1 - no free slot, do not transmit: its transmit result could not
+ *             be matched
+ */
+int znet_inflight_attach( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          znet_node_channel_id_t channel_id,
+                          znet_command_class_t command, uint16_t param,
+                          uint8_t waiters );
+
+/**
+ * @brief Complete an outstanding GET
+ *
+ * Called on report or on failure of transmit. The entry is released.
+ *
+ * @param reported Report is received, its round-trip time is sampled
+ * @return Number of callers waiting for the report, 0 if nothing outstanding,
+ * -1 if the GET already expired and its waiters got an error (late report)
+ */
+int znet_inflight_complete( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                znet_node_channel_id_t channel_id,
+                                znet_command_class_t command, uint16_t param,
+                                int reported );
+
+/**
+ * @brief Transmit of the oldest GET of command class is done
+ *
+ * The stack reports transmits in the order they were sent. On failure the
+ * entry is released and its waiters get an error. A GET does not expire
+ * before the result of its transmit.
+ *
+ * @param ok Transmit succeeded
+ * @param entry Key of the GET, set when it is found
+ * @return Number of callers waiting for the failed GET, 0 if it succeeded or
+ * is not tracked
+ */
+uint8_t znet_inflight_transmitted( znet_ctx_t* ctx,
+                                   znet_command_class_t command, int ok,
+                                   znet_inflight_t* entry );
+
+/**
+ * @brief Fail GETs without report within the timeout of their node
+ */
+void znet_inflight_proc( znet_ctx_t* ctx );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_INFLIGHT_H
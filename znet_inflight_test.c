@@ -0,0 +1,195 @@
+/**
+ * @file znet_inflight_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of outstanding GET requests.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_inflight_test.c -o znet_inflight_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_inflight.c"
+
+#define TEST_NODE 5
+#define TEST_TIMEOUT 1000
+
+static struct
+{
+    uint64_t now;
+    size_t errors;
+    size_t losses;
+} test;
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return test.now;
+}
+
+void znet_configuration_get_failed( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                    znet_node_channel_id_t channel_id,
+                                    uint8_t config_param_num, uint8_t waiters )
+{
+    (void)ctx;
+    (void)channel_id;
+    assert( node_id == TEST_NODE && config_param_num == 1 );
+    test.errors += waiters;
+}
+
+uint32_t znet_rtt_timeout( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+    return TEST_TIMEOUT;
+}
+
+void znet_rtt_sample( znet_ctx_t* ctx, znet_node_id_t node_id, uint32_t rtt_ms )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)rtt_ms;
+}
+
+void znet_rtt_loss( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+    test.losses++;
+}
+
+void znet_airtime_failure( znet_ctx_t* ctx )
+{
+    (void)ctx;
+}
+
+void znet_airtime_success( znet_ctx_t* ctx )
+{
+    (void)ctx;
+}
+
+void znet_health_contact( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+}
+
+void znet_health_loss( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    for( size_t i = 0; i < ZNET_INFLIGHT_MAX; i++ )
+        _test_ctx.inflight[i].node_id = ZNET_NODE_ID_INVALID;
+    test.now = 1000000;
+    return &_test_ctx;
+}
+
+static int _test_attach( znet_ctx_t* ctx, uint16_t param )
+{
+    return znet_inflight_attach( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                 ZNET_COMMAND_CLASS_CONFIGURATION, param, 1 );
+}
+
+static uint8_t _test_transmitted( znet_ctx_t* ctx, int ok, uint16_t param )
+{
+    znet_inflight_t entry = { .node_id = ZNET_NODE_ID_INVALID };
+    uint8_t waiters = znet_inflight_transmitted(
+        ctx, ZNET_COMMAND_CLASS_CONFIGURATION, ok, &entry );
+    assert( entry.node_id == TEST_NODE && entry.param == param );
+    return waiters;
+}
+
+/// INFO: identical GETs share one transmit, all callers get the result
+static void _test_fan_out( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( _test_attach( ctx, 1 ) == 0 );
+    assert( _test_attach( ctx, 1 ) == 1 );
+    assert( _test_attach( ctx, 1 ) == 1 );
+    assert( _test_transmitted( ctx, 1, 1 ) == 0 );
+    assert( znet_inflight_complete( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                    ZNET_COMMAND_CLASS_CONFIGURATION, 1,
+                                    1 ) == 3 );
+
+    /// INFO: a failed transmit fails every caller
+    assert( _test_attach( ctx, 2 ) == 0 );
+    assert( _test_attach( ctx, 2 ) == 1 );
+    assert( _test_transmitted( ctx, 0, 2 ) == 2 );
+    assert( _test_attach( ctx, 2 ) == 0 );
+}
+
+/// INFO: a GET without slot is not sent, the slots keep their transmits
+static void _test_full( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    for( uint16_t i = 1; i <= ZNET_INFLIGHT_MAX; i++ )
+        assert( _test_attach( ctx, i ) == 0 );
+    assert( _test_attach( ctx, ZNET_INFLIGHT_MAX + 1 ) == -1 );
+
+    for( uint16_t i = 1; i <= ZNET_INFLIGHT_MAX; i++ )
+        assert( _test_transmitted( ctx, 1, i ) == 0 );
+}
+
+/// INFO: transmits are matched in order across the wrap of their numbers
+static void _test_wrap( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( _test_attach( ctx, 1 ) == 0 );
+    for( uint16_t i = 2; i < 600; i++ )
+    {
+        assert( _test_attach( ctx, i ) == 0 );
+        assert( _test_transmitted( ctx, 1, i - 1 ) == 0 );
+        assert( znet_inflight_complete( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                        ZNET_COMMAND_CLASS_CONFIGURATION,
+                                        i - 1, 1 ) == 1 );
+    }
+    assert( _test_transmitted( ctx, 1, 599 ) == 0 );
+}
+
+/// INFO: a GET waits for its transmit result, then expires once and keeps a
+/// marker for the late report
+static void _test_expire( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( _test_attach( ctx, 1 ) == 0 );
+    assert( _test_attach( ctx, 1 ) == 1 );
+
+    test.now += 2 * TEST_TIMEOUT;
+    znet_inflight_proc( ctx );
+    assert( test.errors == 0 );
+
+    assert( _test_transmitted( ctx, 1, 1 ) == 0 );
+    znet_inflight_proc( ctx );
+    assert( test.errors == 2 && test.losses == 1 );
+
+    assert( znet_inflight_complete( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                    ZNET_COMMAND_CLASS_CONFIGURATION, 1,
+                                    1 ) == -1 );
+    assert( znet_inflight_complete( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                    ZNET_COMMAND_CLASS_CONFIGURATION, 1,
+                                    1 ) == 0 );
+}
+
+int main( void )
+{
+    _test_fan_out();
+    _test_full();
+    _test_wrap();
+    _test_expire();
+    printf( "znet_inflight_test: OK\n" );
+    return 0;
+}
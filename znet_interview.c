@@ -0,0 +1,351 @@
+/**
+ * @file znet_interview.c
+ * @date 18 Oct 2026
+ * @brief Background interview of added nodes.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_interview.h"
+#include "znet_dispatch.h"
+#include "znet_deferred.h"
+#include "znet_airtime.h"
+#include "znet_health.h"
+#include "znet_rtt.h"
+
+/// INFO: command modules without context API serve the default context only
+#define ZNET_INTERVIEW_DEFAULT_CTX( ctx )                                      \
+    do                                                                         \
+    {                                                                          \
+        if( ( ctx ) != znet_ctx_default )                                      \
+            return -1;                                                         \
+    } while( 0 )
+
+#if ZNET_CFG_CC_VERSION
+static int _znet_interview_version( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    ZNET_INTERVIEW_DEFAULT_CTX( ctx );
+    znet_node_cmd_version_get( node_id );
+    return 0;
+}
+#endif
+
+#if ZNET_CFG_CC_MANUFACTURER_SPECIFIC
+static int _znet_interview_manufacturer( znet_ctx_t* ctx,
+                                         znet_node_id_t node_id )
+{
+    ZNET_INTERVIEW_DEFAULT_CTX( ctx );
+    znet_node_cmd_manufacturer_specific_get( node_id );
+    return 0;
+}
+#endif
+
+#if ZNET_CFG_CC_ZWAVEPLUS_INFO
+static int _znet_interview_zwaveplus( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    ZNET_INTERVIEW_DEFAULT_CTX( ctx );
+    znet_node_cmd_zwaveplus_info_get( node_id );
+    return 0;
+}
+#endif
+
+#if ZNET_CFG_CC_MULTICHANNEL
+static int _znet_interview_multichannel( znet_ctx_t* ctx,
+                                         znet_node_id_t node_id )
+{
+    ZNET_INTERVIEW_DEFAULT_CTX( ctx );
+    znet_node_cmd_multichannel_endpoint_get( node_id );
+    return 0;
+}
+#endif
+
+#if ZNET_CFG_CC_CONFIGURATION
+static int _znet_interview_configuration( znet_ctx_t* ctx,
+                                          znet_node_id_t node_id )
+{
+    znet_ctx_node_cmd_configuration_walk( ctx, node_id, ZNET_CHANNEL_ID_ROOT );
+    return 0;
+}
+#endif
+
+/// INFO: steps in the order of interview
+static const struct
+{
+    uint8_t step;                 /**< ZNET_INTERVIEW_* */
+    znet_command_class_t command; /**< Command class of step */
+    int ( *send )( znet_ctx_t* ctx, znet_node_id_t node_id );
+} _znet_interview_steps[] = {
+#if ZNET_CFG_CC_VERSION
+    { ZNET_INTERVIEW_VERSION, 0x86, _znet_interview_version },
+#endif
+#if ZNET_CFG_CC_MANUFACTURER_SPECIFIC
+    { ZNET_INTERVIEW_MANUFACTURER, 0x72, _znet_interview_manufacturer },
+#endif
+#if ZNET_CFG_CC_ZWAVEPLUS_INFO
+    { ZNET_INTERVIEW_ZWAVEPLUS, 0x5E, _znet_interview_zwaveplus },
+#endif
+#if ZNET_CFG_CC_MULTICHANNEL
+    { ZNET_INTERVIEW_MULTICHANNEL, 0x60, _znet_interview_multichannel },
+#endif
+#if ZNET_CFG_CC_CONFIGURATION
+    { ZNET_INTERVIEW_CONFIGURATION, ZNET_COMMAND_CLASS_CONFIGURATION,
+      _znet_interview_configuration },
+#endif
+};
+
+#define ZNET_INTERVIEW_STEPS \
+    ( sizeof( _znet_interview_steps ) / sizeof( _znet_interview_steps[0] ) )
+
+static znet_interview_t* _znet_interview_find( znet_interview_queue_t* queue,
+                                               znet_node_id_t node_id )
+{
+    for( size_t i = 0; i < ZNET_INTERVIEW_MAX; i++ )
+        if( queue->nodes[i].seq && queue->nodes[i].node_id == node_id )
+            return &queue->nodes[i];
+    return NULL;
+}
+
+static void _znet_interview_release( znet_interview_queue_t* queue,
+                                     znet_interview_t* it )
+{
+    if( queue->active == it )
+        queue->active = NULL;
+    it->seq = 0;
+    queue->queued--;
+}
+
+/// INFO: the slot is free before the callbacks, they may queue a node
+static void _znet_interview_notify( znet_ctx_t* ctx, znet_interview_t* it,
+                                    uint8_t step, int err )
+{
+    znet_interview_queue_t* queue = &ctx->interview;
+    znet_node_id_t node_id = it->node_id;
+
+    znet_interview_progress_t progress = {
+        .step = step, .done = it->done, .failed = it->failed,
+        .pending = it->pending };
+    int finished = !it->pending && !it->step;
+    if( finished )
+        _znet_interview_release( queue, it );
+    progress.queued = queue->queued;
+
+    if( step )
+        znet_dispatch( ctx, ZNET_EVENT_NODE_INTERVIEW, err, node_id,
+                       ZNET_CHANNEL_ID_ROOT, &progress, sizeof( progress ) );
+    if( !finished )
+        return;
+
+    ZNET_LOGI( "ZNET: Interview of node %u finished, failed steps 0x%02X\n",
+               node_id, progress.failed );
+    progress.step = 0;
+    znet_dispatch( ctx, ZNET_EVENT_NODE_INTERVIEW, progress.failed ? -1 : 0,
+                   node_id, ZNET_CHANNEL_ID_ROOT, &progress,
+                   sizeof( progress ) );
+}
+
+static void _znet_interview_step_end( znet_ctx_t* ctx, znet_interview_t* it,
+                                      int err )
+{
+    uint8_t step = it->step;
+    it->step = 0;
+    it->parked = 0;
+    if( err )
+        it->failed |= step;
+    else
+        it->done |= step;
+    _znet_interview_notify( ctx, it, step, err );
+}
+
+static znet_interview_t* _znet_interview_first( znet_interview_queue_t* queue )
+{
+    znet_interview_t* first = NULL;
+    for( size_t i = 0; i < ZNET_INTERVIEW_MAX; i++ )
+    {
+        znet_interview_t* it = &queue->nodes[i];
+        if( it->seq && !it->step && ( !first || it->seq < first->seq ) )
+            first = it;
+    }
+    return first;
+}
+
+/// INFO: a held GET waits for wake up of node, the step times out from its
+/// transmit on
+static void _znet_interview_wait( znet_ctx_t* ctx, znet_interview_t* it,
+                                  uint64_t now )
+{
+    if( znet_ctx_node_deferred_count( ctx, it->node_id ) )
+    {
+        it->parked = 1;
+        return;
+    }
+    if( it->parked )
+    {
+        it->parked = 0;
+        it->tx_time = now;
+    }
+
+    /// INFO: discovery reports its end
+    if( it->step == ZNET_INTERVIEW_CONFIGURATION ||
+        now - it->tx_time <= znet_rtt_timeout( ctx, it->node_id ) )
+        return;
+
+    ZNET_LOGD( "ZNET: Interview step 0x%02X of node %u timed out\n", it->step,
+               it->node_id );
+    _znet_interview_step_end( ctx, it, -1 );
+}
+
+void znet_interview_init( znet_ctx_t* ctx )
+{
+    memset( &ctx->interview, 0, sizeof( znet_interview_queue_t ) );
+}
+
+void znet_interview_proc( znet_ctx_t* ctx )
+{
+    znet_interview_queue_t* queue = &ctx->interview;
+    if( !queue->queued )
+        return;
+
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    for( size_t i = 0; i < ZNET_INTERVIEW_MAX; i++ )
+        if( queue->nodes[i].seq && queue->nodes[i].step )
+            _znet_interview_wait( ctx, &queue->nodes[i], now );
+
+    /// INFO: the step of a sleeping node waits aside, the next node goes on
+    if( queue->active && queue->active->parked )
+        queue->active = NULL;
+    if( !queue->active )
+        queue->active = _znet_interview_first( queue );
+    znet_interview_t* it = queue->active;
+    if( !it || it->step )
+        return;
+
+    /// INFO: nothing more to ask, or nobody to answer
+    if( ctx->health.nodes[it->node_id].failed )
+    {
+        it->failed |= it->pending;
+        it->pending = 0;
+    }
+    if( !it->pending )
+    {
+        _znet_interview_notify( ctx, it, 0, 0 );
+        return;
+    }
+
+    /// INFO: lowest priority, normal traffic goes first
+    if( ctx->deferred.throttled ||
+        !znet_airtime_admit( ctx, it->node_id, ZNET_INTERVIEW_PAYLOAD ) )
+        return;
+
+    for( size_t i = 0; i < ZNET_INTERVIEW_STEPS; i++ )
+    {
+        if( !( it->pending & _znet_interview_steps[i].step ) )
+            continue;
+
+        it->pending &= (uint8_t)~_znet_interview_steps[i].step;
+        it->step = _znet_interview_steps[i].step;
+        it->tx_time = now;
+        if( _znet_interview_steps[i].send( ctx, it->node_id ) )
+            _znet_interview_step_end( ctx, it, -1 );
+        return;
+    }
+}
+
+void znet_interview_node_added( znet_ctx_t* ctx,
+                                const znet_nodeinfo_t* node_info )
+{
+    if( !ctx->interview.auto_steps || !node_info )
+        return;
+
+    if( znet_ctx_node_interview( ctx, node_info, ctx->interview.auto_steps ) )
+        ZNET_LOGW( "ZNET: Interview of node %u is not queued!\n",
+                   node_info->node_id );
+}
+
+void znet_interview_report( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_command_class_t command, int err )
+{
+    znet_interview_t* it = _znet_interview_find( &ctx->interview, node_id );
+    if( !it || !it->step )
+        return;
+
+    for( size_t i = 0; i < ZNET_INTERVIEW_STEPS; i++ )
+        if( _znet_interview_steps[i].step == it->step &&
+            _znet_interview_steps[i].command == command )
+        {
+            _znet_interview_step_end( ctx, it, err ? -1 : 0 );
+            return;
+        }
+}
+
+int znet_ctx_interview_auto( znet_ctx_t* ctx, uint8_t steps )
+{
+    if( !ctx || ( steps & ~ZNET_INTERVIEW_ALL ) )
+        return -1;
+
+    ctx->interview.auto_steps = steps;
+    return 0;
+}
+
+int znet_ctx_node_interview( znet_ctx_t* ctx, const znet_nodeinfo_t* node_info,
+                             uint8_t steps )
+{
+    if( !ctx || !node_info || ( steps & ~ZNET_INTERVIEW_ALL ) )
+        return -1;
+
+    znet_node_id_t node_id = node_info->node_id;
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
+        return -1;
+
+    znet_interview_queue_t* queue = &ctx->interview;
+    if( _znet_interview_find( queue, node_id ) )
+        return -1;
+
+    znet_interview_t* slot = NULL;
+    for( size_t i = 0; !slot && i < ZNET_INTERVIEW_MAX; i++ )
+        if( !queue->nodes[i].seq )
+            slot = &queue->nodes[i];
+    if( !slot )
+        return -1;
+
+    /// INFO: ask only for command classes the node supports
+    uint8_t pending = 0;
+    for( size_t i = 0; i < ZNET_INTERVIEW_STEPS; i++ )
+    {
+        if( !( steps & _znet_interview_steps[i].step ) )
+            continue;
+        for( uint8_t c = 0; c < node_info->commands_count; c++ )
+            if( node_info->commands[c] == _znet_interview_steps[i].command )
+            {
+                pending |= _znet_interview_steps[i].step;
+                break;
+            }
+    }
+
+    memset( slot, 0, sizeof( znet_interview_t ) );
+    slot->seq = ++queue->seq;
+    slot->node_id = node_id;
+    slot->pending = pending;
+    queue->queued++;
+    return 0;
+}
+
+int znet_ctx_node_interview_cancel( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    if( !ctx )
+        return -1;
+
+    znet_interview_t* it = _znet_interview_find( &ctx->interview, node_id );
+    if( !it )
+        return -1;
+
+    _znet_interview_release( &ctx->interview, it );
+    return 0;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file znet_interview.h
+ * @date 18 Oct 2026
+ * @brief Background interview of added nodes.
+ */
+
+#ifndef ZNET_INTERVIEW_H
+#define ZNET_INTERVIEW_H
+
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max number of nodes waiting for interview
+ */
+#define ZNET_INTERVIEW_MAX 32
+
+/**
+ * @brief Payload of interview GET used to ask for airtime (bytes)
+ */
+#define ZNET_INTERVIEW_PAYLOAD 2
+
+/**
+ * @brief Interview of one node
+ */
+typedef struct znet_interview_t
+{
+    uint32_t seq;           /**< Order, 0 - free slot */
+    znet_node_id_t node_id; /**< Node ID */
+    uint8_t pending;        /**< Steps left */
+    uint8_t done;           /**< Steps answered */
+    uint8_t failed;         /**< Steps without answer */
+    uint8_t step;           /**< Step waiting for report, 0 - none */
+    uint8_t parked;         /**< flag: GET of step held until wake up */
+    uint64_t tx_time;       /**< Time of transmit of step (ms) */
+} znet_interview_t;
+
+/**
+ * @brief Interview queue of the context
+ */
+typedef struct znet_interview_queue_t
+{
+    uint8_t auto_steps;  /**< Steps of added nodes, 0 - off */
+    uint32_t seq;        /**< Last order number */
+    uint16_t queued;     /**< Nodes in the queue */
+    znet_interview_t* active; /**< Interview sending steps */
+    znet_interview_t nodes[ZNET_INTERVIEW_MAX];
+} znet_interview_queue_t;
+
+/**
+ * @brief Init empty queue, automatic interview is off
+ */
+void znet_interview_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Send next step when airtime is idle, fail step without report
+ *
+ * The step of a node with held commands waits for its wake up aside, the
+ * interview of the next node goes on meanwhile.
+ */
+void znet_interview_proc( znet_ctx_t* ctx );
+
+/**
+ * @brief Node is added: queue its interview if automatic interview is on
+ *
+ * Called by the core before node_add_result.
+ */
+void znet_interview_node_added( znet_ctx_t* ctx,
+                                const znet_nodeinfo_t* node_info );
+
+/**
+ * @brief Report (or its failure) of command class arrived from node
+ *
+ * Called by the report handlers of the interviewed command classes.
+ * Configuration reports the end of its discovery.
+ */
+void znet_interview_report( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_command_class_t command, int err );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_INTERVIEW_H
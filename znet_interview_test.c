@@ -0,0 +1,219 @@
+/**
+ * @file znet_interview_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of background interview of added nodes.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_interview_test.c -o znet_interview_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_interview.c"
+
+#if ZNET_CFG_CC_VERSION
+
+#define TEST_SLEEPING 5
+#define TEST_AWAKE 6
+#define TEST_TIMEOUT 1000
+
+static struct
+{
+    uint64_t now;
+    uint8_t held[ZNET_NODE_ID_MAX + 1]; /**< Commands held for node */
+    uint8_t sleeping;                   /**< GETs to TEST_SLEEPING are held */
+    znet_node_id_t sent;                /**< Last node asked */
+    size_t gets;                        /**< GETs sent */
+    znet_node_id_t finished;            /**< Last node with interview done */
+    int finished_err;
+} test;
+
+znet_ctx_t* znet_ctx_default;
+
+void znet_node_cmd_version_get( znet_node_id_t node_id )
+{
+    test.sent = node_id;
+    test.gets++;
+    if( node_id == TEST_SLEEPING && test.sleeping )
+        test.held[node_id]++;
+}
+
+#if ZNET_CFG_CC_MANUFACTURER_SPECIFIC
+void znet_node_cmd_manufacturer_specific_get( znet_node_id_t node_id )
+{
+    (void)node_id;
+    assert( 0 );
+}
+#endif
+
+#if ZNET_CFG_CC_ZWAVEPLUS_INFO
+void znet_node_cmd_zwaveplus_info_get( znet_node_id_t node_id )
+{
+    (void)node_id;
+    assert( 0 );
+}
+#endif
+
+#if ZNET_CFG_CC_MULTICHANNEL
+void znet_node_cmd_multichannel_endpoint_get( znet_node_id_t node_id )
+{
+    (void)node_id;
+    assert( 0 );
+}
+#endif
+
+#if ZNET_CFG_CC_CONFIGURATION
+void znet_ctx_node_cmd_configuration_walk( znet_ctx_t* ctx,
+                                           znet_node_id_t node_id,
+                                           znet_node_channel_id_t channel_id )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)channel_id;
+    assert( 0 );
+}
+#endif
+
+size_t znet_ctx_node_deferred_count( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    return test.held[node_id];
+}
+
+int znet_airtime_admit( znet_ctx_t* ctx, znet_node_id_t node_id, size_t payload )
+{
+    (void)ctx;
+    (void)node_id;
+    (void)payload;
+    return 1;
+}
+
+uint32_t znet_rtt_timeout( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    (void)ctx;
+    (void)node_id;
+    return TEST_TIMEOUT;
+}
+
+void znet_dispatch( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                    znet_node_id_t node_id, znet_node_channel_id_t channel_id,
+                    const void* value, size_t size )
+{
+    (void)ctx;
+    (void)channel_id;
+    (void)size;
+    const znet_interview_progress_t* progress = value;
+    assert( type == ZNET_EVENT_NODE_INTERVIEW );
+    if( progress->step )
+        return;
+    test.finished = node_id;
+    test.finished_err = err;
+}
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return test.now;
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static void _test_queue( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    union
+    {
+        znet_nodeinfo_t info;
+        uint8_t raw[sizeof( znet_nodeinfo_t ) + 1];
+    } node;
+    memset( &node, 0, sizeof( node ) );
+    node.info.node_id = node_id;
+    node.info.commands_count = 1;
+    node.info.commands[0] = 0x86;
+    assert( !znet_ctx_node_interview( ctx, &node.info, ZNET_INTERVIEW_ALL ) );
+}
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_ctx_default = &_test_ctx;
+    znet_interview_init( &_test_ctx );
+    test.now = 1000000;
+    test.sleeping = 1;
+    _test_queue( &_test_ctx, TEST_SLEEPING );
+    _test_queue( &_test_ctx, TEST_AWAKE );
+    return &_test_ctx;
+}
+
+/// INFO: a held step waits aside, the next node is interviewed meanwhile
+static void _test_park( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_interview_proc( ctx );
+    assert( test.sent == TEST_SLEEPING && test.held[TEST_SLEEPING] );
+
+    znet_interview_proc( ctx );
+    assert( test.sent == TEST_AWAKE && test.gets == 2 );
+    znet_interview_report( ctx, TEST_AWAKE, 0x86, 0 );
+    znet_interview_proc( ctx );
+    assert( test.finished == TEST_AWAKE && !test.finished_err );
+
+    /// INFO: no timeout while the GET is held
+    test.now += 10 * TEST_TIMEOUT;
+    znet_interview_proc( ctx );
+    assert( !test.finished_err && ctx->interview.queued == 1 );
+
+    /// INFO: the report after wake up ends the parked step
+    test.held[TEST_SLEEPING] = 0;
+    znet_interview_proc( ctx );
+    znet_interview_report( ctx, TEST_SLEEPING, 0x86, 0 );
+    znet_interview_proc( ctx );
+    assert( test.finished == TEST_SLEEPING && !test.finished_err );
+    assert( !ctx->interview.queued && test.gets == 2 );
+}
+
+/// INFO: the step times out from the wake up of node on
+static void _test_park_timeout( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_interview_proc( ctx );
+    znet_interview_proc( ctx );
+    znet_interview_report( ctx, TEST_AWAKE, 0x86, 0 );
+
+    test.now += 10 * TEST_TIMEOUT;
+    test.held[TEST_SLEEPING] = 0;
+    znet_interview_proc( ctx );
+    assert( test.finished == TEST_AWAKE );
+
+    test.now += TEST_TIMEOUT;
+    znet_interview_proc( ctx );
+    assert( test.finished == TEST_AWAKE );
+
+    test.now++;
+    znet_interview_proc( ctx );
+    assert( test.finished == TEST_SLEEPING && test.finished_err == -1 );
+    assert( !ctx->interview.queued );
+}
+
+int main( void )
+{
+    _test_park();
+    _test_park_timeout();
+    printf( "znet_interview_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_VERSION
@@ -0,0 +1,249 @@
+/**
+ * @file znet_mem.c
+ * @date 18 Oct 2026
+ * @brief Memory of the library modules: ZNET_ALLOC or static pools.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_mem.h"
+
+static void _znet_mem_account( znet_ctx_t* ctx, znet_mem_tag_t tag,
+                               size_t old_size, size_t size )
+{
+    znet_mem_stats_t* stats = &ctx->mem.stats[tag];
+
+    stats->live = stats->live - old_size + size;
+    if( stats->live > stats->high_water )
+        stats->high_water = stats->live;
+    if( !old_size && size )
+        stats->allocs++;
+    if( old_size && !size )
+        stats->frees++;
+}
+
+static void _znet_mem_init_stats( znet_ctx_t* ctx )
+{
+    memset( ctx->mem.stats, 0, sizeof( ctx->mem.stats ) );
+    _znet_mem_account( ctx, ZNET_MEM_TAG_CONTEXT, 0, sizeof( znet_ctx_t ) );
+}
+
+#if ZNET_CFG_STATIC_MEMORY
+
+_Static_assert( ZNET_MEM_METER_ROLLUP_COUNT <= 64 &&
+                    ZNET_MEM_PARAM_PARAMS_COUNT <= 64 &&
+                    ZNET_MEM_DISPATCH_COUNT <= 64,
+                "pool is limited by 64 blocks" );
+
+static znet_ctx_t _znet_mem_ctx[ZNET_CFG_STATIC_CTX_MAX];
+static uint8_t _znet_mem_ctx_busy[ZNET_CFG_STATIC_CTX_MAX];
+
+static void _znet_mem_pool_init( znet_mem_pool_t* pool, uint8_t* base,
+                                 size_t block, uint8_t count )
+{
+    pool->block = ZNET_MEM_ALIGN( block );
+    pool->count = count;
+    pool->used = 0;
+    pool->base = base;
+}
+
+void znet_mem_init( znet_ctx_t* ctx )
+{
+    znet_mem_t* mem = &ctx->mem;
+
+    _znet_mem_init_stats( ctx );
+    _znet_mem_pool_init( &mem->pools[ZNET_MEM_TAG_CONTEXT], NULL, 0, 0 );
+    _znet_mem_pool_init( &mem->pools[ZNET_MEM_TAG_PARAM_MODELS], mem->param_models,
+                         ZNET_MEM_PARAM_MODELS_BLOCK, ZNET_MEM_PARAM_MODELS_COUNT );
+    _znet_mem_pool_init( &mem->pools[ZNET_MEM_TAG_PARAM_PARAMS], mem->param_params,
+                         ZNET_MEM_PARAM_PARAMS_BLOCK, ZNET_MEM_PARAM_PARAMS_COUNT );
+    _znet_mem_pool_init( &mem->pools[ZNET_MEM_TAG_WALK], mem->walk,
+                         ZNET_MEM_WALK_BLOCK, ZNET_MEM_WALK_COUNT );
+    _znet_mem_pool_init( &mem->pools[ZNET_MEM_TAG_BACKUP], mem->backup,
+                         ZNET_MEM_BACKUP_BLOCK, ZNET_MEM_BACKUP_COUNT );
+    _znet_mem_pool_init( &mem->pools[ZNET_MEM_TAG_METER_RING], mem->meter_ring,
+                         ZNET_MEM_METER_RING_BLOCK, ZNET_MEM_METER_RING_COUNT );
+    _znet_mem_pool_init( &mem->pools[ZNET_MEM_TAG_METER_ROLLUP], mem->meter_rollup,
+                         ZNET_MEM_METER_ROLLUP_BLOCK, ZNET_MEM_METER_ROLLUP_COUNT );
+    _znet_mem_pool_init( &mem->pools[ZNET_MEM_TAG_DISPATCH], mem->dispatch,
+                         ZNET_MEM_DISPATCH_BLOCK, ZNET_MEM_DISPATCH_COUNT );
+}
+
+void* znet_mem_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag, void* ptr,
+                      size_t size )
+{
+    znet_mem_pool_t* pool = &ctx->mem.pools[tag];
+
+    size_t index = 0;
+    if( ptr )
+    {
+        index = (size_t)( (uint8_t*)ptr - pool->base ) / pool->block;
+        assert( index < pool->count );
+
+        if( !size )
+        {
+            _znet_mem_account( ctx, tag, pool->sizes[index], 0 );
+            pool->used &= ~( (uint64_t)1 << index );
+            return NULL;
+        }
+    }
+    else if( !size )
+        return NULL;
+
+    if( size > pool->block )
+    {
+        ZNET_LOGE( "ZNET: Block of %zu bytes is over pool %u (%zu)!\n",
+                   size, (unsigned)tag, pool->block );
+        ctx->mem.stats[tag].failures++;
+        return NULL;
+    }
+
+    if( ptr )
+    {
+        _znet_mem_account( ctx, tag, pool->sizes[index], size );
+        pool->sizes[index] = (uint32_t)size;
+        return ptr;
+    }
+
+    for( uint8_t i = 0; i < pool->count; i++ )
+    {
+        uint64_t bit = (uint64_t)1 << i;
+        if( pool->used & bit )
+            continue;
+        pool->used |= bit;
+        pool->sizes[i] = (uint32_t)size;
+        _znet_mem_account( ctx, tag, 0, size );
+        return pool->base + i * pool->block;
+    }
+
+    ZNET_LOGE( "ZNET: Pool %u is full!\n", (unsigned)tag );
+    ctx->mem.stats[tag].failures++;
+    return NULL;
+}
+
+znet_ctx_t* znet_mem_ctx_alloc( const znet_callbacks_t* callbacks )
+{
+    (void)callbacks;
+
+    for( size_t i = 0; i < ZNET_CFG_STATIC_CTX_MAX; i++ )
+    {
+        if( _znet_mem_ctx_busy[i] )
+            continue;
+        _znet_mem_ctx_busy[i] = 1;
+        return &_znet_mem_ctx[i];
+    }
+    return NULL;
+}
+
+void znet_mem_ctx_free( znet_ctx_t* ctx )
+{
+    size_t index = (size_t)( ctx - _znet_mem_ctx );
+    assert( index < ZNET_CFG_STATIC_CTX_MAX );
+    _znet_mem_ctx_busy[index] = 0;
+}
+
+#else
+
+/// INFO: size of block in front of it, keeps the alignment of the allocator
+typedef union znet_mem_header_t
+{
+    size_t size;
+    max_align_t __align;
+} znet_mem_header_t;
+
+void znet_mem_init( znet_ctx_t* ctx )
+{
+    _znet_mem_init_stats( ctx );
+}
+
+void* znet_mem_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag, void* ptr,
+                      size_t size )
+{
+    const znet_callbacks_t* cb = ctx->cb;
+
+    znet_mem_header_t* header = ptr ? (znet_mem_header_t*)ptr - 1 : NULL;
+    size_t old_size = header ? header->size : 0;
+
+    if( !size )
+    {
+        if( header )
+            cb->alloc( header, 0, cb->arg );
+        _znet_mem_account( ctx, tag, old_size, 0 );
+        return NULL;
+    }
+
+    header = (znet_mem_header_t*)cb->alloc(
+        header, sizeof( znet_mem_header_t ) + size, cb->arg );
+    if( !header )
+    {
+        ctx->mem.stats[tag].failures++;
+        return NULL;
+    }
+
+    header->size = size;
+    _znet_mem_account( ctx, tag, old_size, size );
+    return header + 1;
+}
+
+znet_ctx_t* znet_mem_ctx_alloc( const znet_callbacks_t* callbacks )
+{
+    return (znet_ctx_t*)callbacks->alloc( NULL, sizeof( znet_ctx_t ),
+                                          callbacks->arg );
+}
+
+void znet_mem_ctx_free( znet_ctx_t* ctx )
+{
+    const znet_callbacks_t* cb = ctx->cb;
+    cb->alloc( ctx, 0, cb->arg );
+}
+
+#endif  // ZNET_CFG_STATIC_MEMORY
+
+void znet_memory_report( znet_memory_report_t* report )
+{
+    if( !report )
+        return;
+
+    memset( report, 0, sizeof( znet_memory_report_t ) );
+    report->context = sizeof( znet_ctx_t );
+    report->queues = sizeof( ( (znet_ctx_t*)0 )->uart ) +
+                     sizeof( ( (znet_ctx_t*)0 )->inflight ) +
+                     sizeof( ( (znet_ctx_t*)0 )->dispatch ) +
+                     sizeof( ( (znet_ctx_t*)0 )->deferred );
+    report->nodes = sizeof( ( (znet_ctx_t*)0 )->rtt ) +
+                    sizeof( ( (znet_ctx_t*)0 )->airtime ) +
+                    sizeof( ( (znet_ctx_t*)0 )->state ) +
+                    sizeof( ( (znet_ctx_t*)0 )->subscribe );
+
+#if ZNET_CFG_STATIC_MEMORY
+    report->param_db = ZNET_MEM_STORAGE( PARAM_MODELS ) +
+                       ZNET_MEM_STORAGE( PARAM_PARAMS );
+    report->walks = ZNET_MEM_STORAGE( WALK );
+    report->backups = ZNET_MEM_STORAGE( BACKUP );
+    report->meter_series = ZNET_MEM_STORAGE( METER_RING ) +
+                           ZNET_MEM_STORAGE( METER_ROLLUP );
+    report->queues += ZNET_MEM_STORAGE( DISPATCH );
+    report->total = sizeof( _znet_mem_ctx );
+#else
+    report->total = report->context;
+#endif
+}
+
+int znet_ctx_mem_stats( znet_ctx_t* ctx, znet_mem_tag_t tag,
+                        znet_mem_stats_t* stats )
+{
+    if( !ctx || !stats || (unsigned)tag >= ZNET_MEM_TAG_COUNT )
+        return -1;
+
+    *stats = ctx->mem.stats[tag];
+    return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file znet_mem.h
+ * @date 18 Oct 2026
+ * @brief Memory of the library modules: ZNET_ALLOC or static pools.
+ */
+
+#ifndef ZNET_MEM_H
+#define ZNET_MEM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#include "znet_param_db.h"
+#include "znet_config_walk.h"
+#include "znet_config_backup.h"
+#include "znet_meter_series.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if ZNET_CFG_STATIC_MEMORY
+
+#if ZNET_CFG_CC_CONFIGURATION
+#define ZNET_MEM_PARAM_MODELS_COUNT 1
+#define ZNET_MEM_PARAM_PARAMS_COUNT ZNET_CFG_STATIC_PARAM_MODELS
+#define ZNET_MEM_WALK_COUNT ZNET_CONFIG_WALK_MAX
+#define ZNET_MEM_BACKUP_COUNT ZNET_CONFIG_BACKUP_MAX
+#define ZNET_MEM_DISPATCH_COUNT ZNET_CFG_STATIC_DISPATCH_REPORTS
+#else
+#define ZNET_MEM_PARAM_MODELS_COUNT 0
+#define ZNET_MEM_PARAM_PARAMS_COUNT 0
+#define ZNET_MEM_WALK_COUNT 0
+#define ZNET_MEM_BACKUP_COUNT 0
+#define ZNET_MEM_DISPATCH_COUNT 0
+#endif
+
+#if ZNET_CFG_CC_METER
+#define ZNET_MEM_METER_RING_COUNT ZNET_METER_SERIES_MAX
+#define ZNET_MEM_METER_ROLLUP_COUNT ( ZNET_METER_SERIES_MAX * ZNET_METER_ROLLUP_LEVELS )
+#else
+#define ZNET_MEM_METER_RING_COUNT 0
+#define ZNET_MEM_METER_ROLLUP_COUNT 0
+#endif
+
+#define ZNET_MEM_PARAM_MODELS_BLOCK \
+    ( ZNET_CFG_STATIC_PARAM_MODELS * sizeof( znet_param_model_t ) )
+#define ZNET_MEM_PARAM_PARAMS_BLOCK \
+    ( ZNET_CFG_STATIC_PARAM_PER_MODEL * sizeof( znet_param_meta_t ) )
+#define ZNET_MEM_WALK_BLOCK                           \
+    ( sizeof( znet_configuration_walk_report_t ) +    \
+      ZNET_CFG_STATIC_WALK_PARAMS * sizeof( znet_param_meta_t ) )
+#define ZNET_MEM_BACKUP_BLOCK                         \
+    ( sizeof( znet_configuration_backup_report_t ) +  \
+      ZNET_CFG_STATIC_BACKUP_BYTES )
+#define ZNET_MEM_MAX( a, b ) ( (a) > (b) ? (a) : (b) )
+#define ZNET_MEM_BULK_BLOCK                                                \
+    ZNET_MEM_MAX( sizeof( znet_configuration_bulk_report_t ) +             \
+                      UINT8_MAX * ZNET_CMD_CONFIGURATION_PARAM_NUM_MAX,    \
+                  sizeof( znet_configuration_bulk_values_t ) +             \
+                      UINT8_MAX * sizeof( znet_cmd_configuration_decoded_t ) )
+#define ZNET_MEM_DISPATCH_BLOCK                                            \
+    ZNET_MEM_MAX( ZNET_MEM_MAX( ZNET_MEM_WALK_BLOCK, ZNET_MEM_BACKUP_BLOCK ), \
+                  ZNET_MEM_BULK_BLOCK )
+#define ZNET_MEM_METER_RING_BLOCK ZNET_CFG_STATIC_METER_RAW_BYTES
+#define ZNET_MEM_METER_ROLLUP_BLOCK \
+    ( ZNET_CFG_STATIC_METER_ROLLUPS * sizeof( znet_meter_rollup_t ) )
+
+/**
+ * @brief Block size rounded for alignment of every block
+ */
+#define ZNET_MEM_ALIGN( size ) ( ( (size) + 7 ) & ~(size_t)7 )
+
+/**
+ * @brief Storage of one pool
+ */
+#define ZNET_MEM_STORAGE( name ) \
+    ( ZNET_MEM_##name##_COUNT * ZNET_MEM_ALIGN( ZNET_MEM_##name##_BLOCK ) )
+
+/**
+ * @brief Pool of blocks of the same size
+ *
+ * Realloc within the block size keeps the block, beyond it fails.
+ */
+typedef struct znet_mem_pool_t
+{
+    size_t block;       /**< Block size */
+    uint8_t count;      /**< Blocks */
+    uint64_t used;      /**< bit: block is taken */
+    uint8_t* base;      /**< Storage */
+    uint32_t sizes[64]; /**< Size requested for block */
+} znet_mem_pool_t;
+
+#endif  // ZNET_CFG_STATIC_MEMORY
+
+/**
+ * @brief Memory of the context: counters and static pools
+ */
+typedef struct znet_mem_t
+{
+    znet_mem_stats_t stats[ZNET_MEM_TAG_COUNT]; /**< Counters by owner */
+
+#if ZNET_CFG_STATIC_MEMORY
+    znet_mem_pool_t pools[ZNET_MEM_TAG_COUNT]; /**< Pools by owner */
+
+    /// INFO: +1 keeps arrays of disabled modules valid
+    _Alignas( 8 ) uint8_t param_models[ZNET_MEM_STORAGE( PARAM_MODELS ) + 1];
+    _Alignas( 8 ) uint8_t param_params[ZNET_MEM_STORAGE( PARAM_PARAMS ) + 1];
+    _Alignas( 8 ) uint8_t walk[ZNET_MEM_STORAGE( WALK ) + 1];
+    _Alignas( 8 ) uint8_t backup[ZNET_MEM_STORAGE( BACKUP ) + 1];
+    _Alignas( 8 ) uint8_t meter_ring[ZNET_MEM_STORAGE( METER_RING ) + 1];
+    _Alignas( 8 ) uint8_t meter_rollup[ZNET_MEM_STORAGE( METER_ROLLUP ) + 1];
+    _Alignas( 8 ) uint8_t dispatch[ZNET_MEM_STORAGE( DISPATCH ) + 1];
+#endif
+} znet_mem_t;
+
+/**
+ * @brief Init counters and pools of the context
+ */
+void znet_mem_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Allocate/reallocate/free block with the semantics of ZNET_ALLOC
+ *
+ * The block is counted by its owner. Blocks of ZNET_ALLOC carry a header with
+ * their size.
+ *
+ * @param ctx Context
+ * @param tag Owner of block
+ * @param ptr Block or NULL
+ * @param size New size, 0 - free
+ * @return Block or NULL if no memory (ptr is kept)
+ */
+void* znet_mem_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag, void* ptr,
+                      size_t size );
+
+/**
+ * @brief Allocate context
+ */
+znet_ctx_t* znet_mem_ctx_alloc( const znet_callbacks_t* callbacks );
+
+/**
+ * @brief Release context
+ */
+void znet_mem_ctx_free( znet_ctx_t* ctx );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_MEM_H
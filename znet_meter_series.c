@@ -0,0 +1,350 @@
+/**
+ * @file znet_meter_series.c
+ * @date 18 Oct 2026
+ * @brief History of meter values with rollups.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_meter_series.h"
+#include "znet_mem.h"
+
+#if ZNET_CFG_CC_METER
+
+/// INFO: zigzag varint of 64 bit value takes 10 bytes max
+#define ZNET_METER_VARINT_MAX 10
+
+static size_t _znet_meter_varint_put( uint8_t* data, int64_t value )
+{
+    uint64_t zigzag = ( (uint64_t)value << 1 ) ^ (uint64_t)( value >> 63 );
+    size_t size = 0;
+    while( zigzag >= 0x80 )
+    {
+        data[size++] = (uint8_t)( zigzag | 0x80 );
+        zigzag >>= 7;
+    }
+    data[size++] = (uint8_t)zigzag;
+    return size;
+}
+
+static int64_t _znet_meter_varint_get( const znet_meter_series_t* series,
+                                       size_t ring_size, size_t* pos )
+{
+    uint64_t zigzag = 0;
+    unsigned shift = 0;
+    uint8_t byte;
+    do
+    {
+        byte = series->ring[*pos];
+        *pos = ( *pos + 1 ) % ring_size;
+        zigzag |= (uint64_t)( byte & 0x7F ) << shift;
+        shift += 7;
+    } while( byte & 0x80 );
+    return (int64_t)( zigzag >> 1 ) ^ -(int64_t)( zigzag & 1 );
+}
+
+static void _znet_meter_series_release( znet_ctx_t* ctx, znet_meter_series_t* series )
+{
+    znet_mem_alloc( ctx, ZNET_MEM_TAG_METER_RING, series->ring, 0 );
+    for( size_t i = 0; i < ZNET_METER_ROLLUP_LEVELS; i++ )
+        znet_mem_alloc( ctx, ZNET_MEM_TAG_METER_ROLLUP, series->rollups[i].items, 0 );
+    memset( series, 0, sizeof( znet_meter_series_t ) );
+    series->node_id = ZNET_NODE_ID_INVALID;
+}
+
+static znet_meter_series_t* _znet_meter_series_find( znet_ctx_t* ctx,
+                                                     znet_node_id_t node_id,
+                                                     znet_node_channel_id_t channel_id,
+                                                     uint8_t type, uint16_t scale )
+{
+    for( size_t i = 0; i < ZNET_METER_SERIES_MAX; i++ )
+    {
+        znet_meter_series_t* series = &ctx->meter_series.series[i];
+        if( series->node_id == node_id && series->channel_id == channel_id &&
+            series->type == type && series->scale == scale )
+            return series;
+    }
+    return NULL;
+}
+
+static znet_meter_series_t* _znet_meter_series_create( znet_ctx_t* ctx,
+                                                       znet_node_id_t node_id,
+                                                       znet_node_channel_id_t channel_id,
+                                                       uint8_t type, uint16_t scale )
+{
+    const znet_meter_series_config_t* config = &ctx->meter_series.config;
+
+    znet_meter_series_t* series = NULL;
+    for( size_t i = 0; !series && i < ZNET_METER_SERIES_MAX; i++ )
+        if( ctx->meter_series.series[i].node_id == ZNET_NODE_ID_INVALID )
+            series = &ctx->meter_series.series[i];
+    if( !series )
+    {
+        ZNET_LOGW( "ZNET: No room for meter series of node %u!\n", node_id );
+        return NULL;
+    }
+
+    int failed = 0;
+    if( config->raw_bytes )
+    {
+        series->ring = (uint8_t*)znet_mem_alloc( ctx, ZNET_MEM_TAG_METER_RING, NULL,
+                                                config->raw_bytes );
+        failed = !series->ring;
+    }
+    for( size_t i = 0; i < ZNET_METER_ROLLUP_LEVELS; i++ )
+    {
+        if( !config->resolution_s[i] || !config->rollup_capacity[i] )
+            continue;
+        series->rollups[i].items = (znet_meter_rollup_t*)znet_mem_alloc(
+            ctx, ZNET_MEM_TAG_METER_ROLLUP, NULL,
+            config->rollup_capacity[i] * sizeof( znet_meter_rollup_t ) );
+        failed |= !series->rollups[i].items;
+    }
+
+    series->node_id = node_id;
+    if( failed )
+    {
+        ZNET_LOGE( "ZNET: No memory for meter series!\n" );
+        _znet_meter_series_release( ctx, series );
+        return NULL;
+    }
+
+    series->channel_id = channel_id;
+    series->type = type;
+    series->scale = scale;
+    return series;
+}
+
+/// INFO: drop the oldest record into the base
+static void _znet_meter_series_evict( znet_meter_series_t* series,
+                                      size_t ring_size )
+{
+    size_t pos = series->head;
+    series->base_time += (uint64_t)_znet_meter_varint_get( series, ring_size, &pos );
+    series->base_value += (uint32_t)_znet_meter_varint_get( series, ring_size, &pos );
+
+    series->used -= ( pos + ring_size - series->head ) % ring_size;
+    series->head = pos;
+    series->samples--;
+}
+
+static void _znet_meter_rollup_push( znet_meter_rollup_ring_t* rollup,
+                                     uint16_t capacity )
+{
+    rollup->acc.avg = (uint32_t)( rollup->sum / rollup->acc.count );
+
+    uint16_t pos = ( rollup->head + rollup->count ) % capacity;
+    rollup->items[pos] = rollup->acc;
+    if( rollup->count < capacity )
+        rollup->count++;
+    else
+        rollup->head = ( rollup->head + 1 ) % capacity;
+
+    rollup->acc.count = 0;
+    rollup->sum = 0;
+}
+
+static void _znet_meter_rollup_add( znet_ctx_t* ctx, znet_meter_series_t* series,
+                                    uint64_t time, uint32_t value )
+{
+    const znet_meter_series_config_t* config = &ctx->meter_series.config;
+
+    for( size_t i = 0; i < ZNET_METER_ROLLUP_LEVELS; i++ )
+    {
+        znet_meter_rollup_ring_t* rollup = &series->rollups[i];
+        if( !rollup->items )
+            continue;
+
+        uint64_t period = (uint64_t)config->resolution_s[i] * 1000;
+        uint64_t bucket = time / period * period;
+        if( rollup->acc.count && rollup->acc.time != bucket )
+            _znet_meter_rollup_push( rollup, config->rollup_capacity[i] );
+
+        if( !rollup->acc.count )
+        {
+            rollup->acc.time = bucket;
+            rollup->acc.min = value;
+            rollup->acc.max = value;
+        }
+        if( value < rollup->acc.min )
+            rollup->acc.min = value;
+        if( value > rollup->acc.max )
+            rollup->acc.max = value;
+        rollup->sum += value;
+        rollup->acc.count++;
+    }
+}
+
+void znet_meter_series_init( znet_ctx_t* ctx )
+{
+    memset( &ctx->meter_series, 0, sizeof( znet_meter_series_table_t ) );
+    for( size_t i = 0; i < ZNET_METER_SERIES_MAX; i++ )
+        ctx->meter_series.series[i].node_id = ZNET_NODE_ID_INVALID;
+}
+
+void znet_meter_series_free( znet_ctx_t* ctx )
+{
+    for( size_t i = 0; i < ZNET_METER_SERIES_MAX; i++ )
+        if( ctx->meter_series.series[i].node_id != ZNET_NODE_ID_INVALID )
+            _znet_meter_series_release( ctx, &ctx->meter_series.series[i] );
+}
+
+void znet_meter_series_add( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            const znet_meter_report_t* report )
+{
+    const znet_meter_series_config_t* config = &ctx->meter_series.config;
+    size_t ring_size = config->raw_bytes;
+    int rollups = 0;
+    for( size_t i = 0; i < ZNET_METER_ROLLUP_LEVELS; i++ )
+        rollups |= config->resolution_s[i] && config->rollup_capacity[i];
+    if( !ring_size && !rollups )
+        return;
+
+    znet_meter_series_t* series = _znet_meter_series_find(
+        ctx, node_id, channel_id, report->type, report->scale );
+    if( !series )
+        series = _znet_meter_series_create( ctx, node_id, channel_id,
+                                            report->type, report->scale );
+    if( !series )
+        return;
+
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    _znet_meter_rollup_add( ctx, series, now, report->value );
+
+    /// INFO: raw samples are off, rollups only
+    if( !ring_size )
+        return;
+
+    if( !series->samples )
+    {
+        series->base_time = series->last_time = now;
+        series->base_value = series->last_value = report->value;
+        series->samples = 1;
+        return;
+    }
+
+    uint8_t record[2 * ZNET_METER_VARINT_MAX];
+    size_t size = _znet_meter_varint_put( record, (int64_t)( now - series->last_time ) );
+    size += _znet_meter_varint_put( &record[size], (int64_t)report->value -
+                                                   (int64_t)series->last_value );
+    /// INFO: a record of the whole ring would evict itself, the sample is
+    /// dropped, the next delta is taken from the last kept one
+    if( size >= ring_size )
+        return;
+
+    while( series->used + size > ring_size )
+        _znet_meter_series_evict( series, ring_size );
+
+    for( size_t i = 0; i < size; i++ )
+        series->ring[( series->head + series->used + i ) % ring_size] = record[i];
+    series->used += size;
+    series->samples++;
+    series->last_time = now;
+    series->last_value = report->value;
+}
+
+int znet_ctx_meter_series_config( znet_ctx_t* ctx,
+                                  const znet_meter_series_config_t* config )
+{
+    if( !ctx || !config )
+        return -1;
+
+    for( size_t i = 0; i < ZNET_METER_ROLLUP_LEVELS; i++ )
+        if( config->rollup_capacity[i] && !config->resolution_s[i] )
+            return -1;
+
+#if ZNET_CFG_STATIC_MEMORY
+    if( config->raw_bytes > ZNET_CFG_STATIC_METER_RAW_BYTES )
+        return -1;
+    for( size_t i = 0; i < ZNET_METER_ROLLUP_LEVELS; i++ )
+        if( config->rollup_capacity[i] > ZNET_CFG_STATIC_METER_ROLLUPS )
+            return -1;
+#endif
+
+    /// INFO: series of the old sizes are dropped
+    znet_meter_series_free( ctx );
+    ctx->meter_series.config = *config;
+    return 0;
+}
+
+size_t znet_ctx_meter_series_samples( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                      znet_node_channel_id_t channel_id,
+                                      uint8_t type, uint16_t scale,
+                                      znet_meter_sample_t* samples, size_t max )
+{
+    if( !ctx || !samples )
+        return 0;
+
+    const znet_meter_series_t* series =
+        _znet_meter_series_find( ctx, node_id, channel_id, type, scale );
+    if( !series || !series->samples )
+        return 0;
+
+    /// INFO: the newest samples fit
+    size_t skip = series->samples > max ? series->samples - max : 0;
+    size_t ring_size = ctx->meter_series.config.raw_bytes;
+    size_t pos = series->head;
+    uint64_t time = series->base_time;
+    uint32_t value = series->base_value;
+    size_t count = 0;
+
+    for( size_t i = 0; i < series->samples; i++ )
+    {
+        if( i )
+        {
+            time += (uint64_t)_znet_meter_varint_get( series, ring_size, &pos );
+            value += (uint32_t)_znet_meter_varint_get( series, ring_size, &pos );
+        }
+        if( i < skip )
+            continue;
+
+        samples[count].time = time;
+        samples[count].value = value;
+        count++;
+    }
+    return count;
+}
+
+size_t znet_ctx_meter_series_rollups( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                      znet_node_channel_id_t channel_id,
+                                      uint8_t type, uint16_t scale, size_t level,
+                                      znet_meter_rollup_t* rollups, size_t max )
+{
+    if( !ctx || !rollups || level >= ZNET_METER_ROLLUP_LEVELS || !max )
+        return 0;
+
+    const znet_meter_series_t* series =
+        _znet_meter_series_find( ctx, node_id, channel_id, type, scale );
+    if( !series || !series->rollups[level].items )
+        return 0;
+
+    const znet_meter_rollup_ring_t* rollup = &series->rollups[level];
+    uint16_t capacity = ctx->meter_series.config.rollup_capacity[level];
+
+    /// INFO: the bucket in progress is the last one
+    size_t total = rollup->count + ( rollup->acc.count ? 1 : 0 );
+    size_t skip = total > max ? total - max : 0;
+    size_t count = 0;
+
+    for( size_t i = skip; i < rollup->count; i++ )
+        rollups[count++] = rollup->items[( rollup->head + i ) % capacity];
+
+    if( rollup->acc.count )
+    {
+        rollups[count] = rollup->acc;
+        rollups[count].avg = (uint32_t)( rollup->sum / rollup->acc.count );
+        count++;
+    }
+    return count;
+}
+
+#endif  // ZNET_CFG_CC_METER
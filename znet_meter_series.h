@@ -0,0 +1,93 @@
+/**
+ * @file znet_meter_series.h
+ * @date 18 Oct 2026
+ * @brief History of meter values with rollups.
+ */
+
+#ifndef ZNET_METER_SERIES_H
+#define ZNET_METER_SERIES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max number of series of the context
+ */
+#define ZNET_METER_SERIES_MAX 32
+
+/**
+ * @brief Rollup ring of one resolution
+ */
+typedef struct znet_meter_rollup_ring_t
+{
+    znet_meter_rollup_t* items; /**< Ring */
+    uint16_t head;              /**< Oldest item */
+    uint16_t count;             /**< Items */
+    znet_meter_rollup_t acc;    /**< Bucket being accumulated, count 0 - empty */
+    uint64_t sum;               /**< Sum of values of bucket */
+} znet_meter_rollup_ring_t;
+
+/**
+ * @brief Series of one meter: node, channel, type and scale
+ *
+ * Raw samples are delta encoded into a byte ring: every record is zigzag
+ * varint of time delta (ms) and value delta. The oldest record is dropped
+ * into the base when the ring is full.
+ */
+typedef struct znet_meter_series_t
+{
+    znet_node_id_t node_id;            /**< Node ID, INVALID - free slot */
+    znet_node_channel_id_t channel_id; /**< Channel ID */
+    uint8_t type;                      /**< Meter type */
+    uint16_t scale;                    /**< Scale */
+
+    uint64_t base_time;  /**< Time of the oldest sample (ms) */
+    uint32_t base_value; /**< Value of the oldest sample */
+    uint64_t last_time;  /**< Time of the newest sample (ms) */
+    uint32_t last_value; /**< Value of the newest sample */
+    uint32_t samples;    /**< Samples in the ring, including base */
+
+    uint8_t* ring;       /**< Delta records */
+    size_t head;         /**< Oldest record */
+    size_t used;         /**< Bytes used */
+
+    znet_meter_rollup_ring_t rollups[ZNET_METER_ROLLUP_LEVELS]; /**< Rollups */
+} znet_meter_series_t;
+
+/**
+ * @brief Series of the context
+ */
+typedef struct znet_meter_series_table_t
+{
+    znet_meter_series_config_t config;                /**< Sizes, 0 - off */
+    znet_meter_series_t series[ZNET_METER_SERIES_MAX]; /**< Series */
+} znet_meter_series_table_t;
+
+/**
+ * @brief Init without series (off)
+ */
+void znet_meter_series_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Release memory of all series
+ */
+void znet_meter_series_free( znet_ctx_t* ctx );
+
+/**
+ * @brief Add value of Meter Report to its series
+ */
+void znet_meter_series_add( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            const znet_meter_report_t* report );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_METER_SERIES_H
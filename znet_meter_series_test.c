@@ -0,0 +1,157 @@
+/**
+ * @file znet_meter_series_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of meter series: eviction of raw samples and rollups.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_meter_series_test.c -o znet_meter_series_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_meter_series.c"
+
+#if ZNET_CFG_CC_METER
+
+#define TEST_NODE 7
+
+static uint64_t test_now;
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return test_now;
+}
+
+void* znet_mem_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag, void* ptr, size_t size )
+{
+    (void)ctx;
+    (void)tag;
+    if( !size )
+    {
+        free( ptr );
+        return NULL;
+    }
+    return realloc( ptr, size );
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( size_t raw_bytes, uint32_t resolution_s,
+                                uint16_t capacity )
+{
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_meter_series_init( &_test_ctx );
+
+    znet_meter_series_config_t config;
+    memset( &config, 0, sizeof( config ) );
+    config.raw_bytes = raw_bytes;
+    config.resolution_s[0] = resolution_s;
+    config.rollup_capacity[0] = capacity;
+    assert( !znet_ctx_meter_series_config( &_test_ctx, &config ) );
+    test_now = 1000000;
+    return &_test_ctx;
+}
+
+static void _test_add( znet_ctx_t* ctx, uint32_t value )
+{
+    znet_meter_report_t report;
+    memset( &report, 0, sizeof( report ) );
+    report.type = 1;
+    report.value = value;
+    znet_meter_series_add( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, &report );
+}
+
+static size_t _test_samples( znet_ctx_t* ctx, znet_meter_sample_t* samples,
+                             size_t max )
+{
+    return znet_ctx_meter_series_samples( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT,
+                                          1, 0, samples, max );
+}
+
+/// INFO: a record is 3 bytes (1000 ms, +1), 8 bytes keep two of them
+static void _test_evict( void )
+{
+    znet_ctx_t* ctx = _test_setup( 8, 0, 0 );
+    for( uint32_t i = 0; i < 6; i++ )
+    {
+        _test_add( ctx, 100 + i );
+        test_now += 1000;
+    }
+
+    znet_meter_sample_t samples[8];
+    size_t count = _test_samples( ctx, samples, 8 );
+    assert( count == 3 );
+    for( size_t i = 0; i < count; i++ )
+    {
+        assert( samples[i].value == 103 + i );
+        assert( samples[i].time == 1000000 + ( 3 + i ) * 1000 );
+    }
+
+    const znet_meter_series_t* series = &ctx->meter_series.series[0];
+    assert( series->used == 6 && series->samples == 3 );
+    znet_meter_series_free( ctx );
+}
+
+/// INFO: a record as large as the ring is dropped, it must not evict itself
+static void _test_record_of_ring( void )
+{
+    znet_ctx_t* ctx = _test_setup( 3, 0, 0 );
+    for( uint32_t i = 0; i < 3; i++ )
+    {
+        _test_add( ctx, 100 + i );
+        test_now += 1000;
+    }
+
+    znet_meter_sample_t samples[4];
+    assert( _test_samples( ctx, samples, 4 ) == 1 );
+    assert( samples[0].value == 100 && samples[0].time == 1000000 );
+    znet_meter_series_free( ctx );
+}
+
+/// INFO: without raw samples the rollups are kept
+static void _test_rollups_only( void )
+{
+    znet_ctx_t* ctx = _test_setup( 0, 60, 4 );
+    _test_add( ctx, 10 );
+    test_now += 1000;
+    _test_add( ctx, 30 );
+
+    znet_meter_sample_t samples[4];
+    assert( _test_samples( ctx, samples, 4 ) == 0 );
+    assert( ctx->meter_series.series[0].ring == NULL );
+
+    znet_meter_rollup_t rollups[4];
+    size_t count = znet_ctx_meter_series_rollups( ctx, TEST_NODE,
+                                                  ZNET_CHANNEL_ID_ROOT, 1, 0, 0,
+                                                  rollups, 4 );
+    assert( count == 1 );
+    assert( rollups[0].min == 10 && rollups[0].max == 30 && rollups[0].avg == 20 );
+    assert( rollups[0].count == 2 );
+    znet_meter_series_free( ctx );
+}
+
+int main( void )
+{
+    _test_evict();
+    _test_record_of_ring();
+    _test_rollups_only();
+    printf( "znet_meter_series_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_METER
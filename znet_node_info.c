@@ -0,0 +1,36 @@
+/**
+ * @file znet_node_info.c
+ * @date 18 Oct 2026
+ * @brief Node info of all nodes at once.
+ */
+
+/// INFO: crt & system
+#include <stddef.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+_Static_assert( offsetof( znet_nodeinfo_record_t, commands ) ==
+                    offsetof( znet_nodeinfo_t, commands ),
+                "record must keep the layout of znet_nodeinfo_t" );
+_Static_assert( offsetof( znet_nodeinfo_record_t, commands_count ) ==
+                    offsetof( znet_nodeinfo_t, commands_count ),
+                "record must keep the layout of znet_nodeinfo_t" );
+
+size_t znet_node_info_all( znet_nodeinfo_record_t* records, size_t max )
+{
+    if( !records )
+        return 0;
+
+    size_t count = 0;
+    for( size_t id = ZNET_NODE_ID_MIN; id <= ZNET_NODE_ID_MAX && count < max; id++ )
+    {
+        /// INFO: the record is the buffer, filled in place from cache
+        size_t size = sizeof( znet_nodeinfo_record_t );
+        if( znet_node_info( (znet_node_id_t)id, (znet_nodeinfo_t*)&records[count],
+                            &size ) )
+            continue;
+        count++;
+    }
+    return count;
+}
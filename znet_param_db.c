@@ -0,0 +1,574 @@
+/**
+ * @file znet_param_db.c
+ * @date 18 Oct 2026
+ * @brief Configuration parameters metadata shared by identical device models.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_param_db.h"
+#include "znet_mem.h"
+#include "znet_persist.h"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+/// INFO: layout of the store: header, directory of models, parameters
+/// regions of models. Records keep their place, a change rewrites only them.
+typedef struct znet_param_db_header_t
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t end;
+    int16_t node_model[ZNET_NODE_ID_MAX + 1];
+} znet_param_db_header_t;
+
+typedef struct znet_param_db_model_header_t
+{
+    uint16_t manufacturer_id;
+    uint16_t product_type;
+    uint16_t product_id;
+    uint16_t count;
+    uint16_t capacity;
+    uint8_t complete;
+    uint8_t __0;
+    uint32_t offset;
+} znet_param_db_model_header_t;
+
+#define ZNET_PARAM_DB_DIR_OFFSET \
+    ( ZNET_STORE_PARAM_DB_OFFSET + sizeof( znet_param_db_header_t ) )
+#define ZNET_PARAM_DB_DATA_OFFSET                                              \
+    ( ZNET_PARAM_DB_DIR_OFFSET +                                               \
+      ZNET_PARAM_DB_MODELS_MAX * sizeof( znet_param_db_model_header_t ) )
+
+/**
+ * @brief Max directory entries written at once
+ */
+#define ZNET_PARAM_DB_RUN_MAX 8
+
+static void* _znet_param_db_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag,
+                                   void* ptr, size_t size )
+{
+    return znet_mem_alloc( ctx, tag, ptr, size );
+}
+
+static void _znet_param_db_reset( znet_ctx_t* ctx )
+{
+    znet_param_db_t* db = &ctx->param_db;
+
+    for( uint16_t i = 0; i < db->count; i++ )
+        _znet_param_db_alloc( ctx, ZNET_MEM_TAG_PARAM_PARAMS, db->models[i].params, 0 );
+    _znet_param_db_alloc( ctx, ZNET_MEM_TAG_PARAM_MODELS, db->models, 0 );
+
+    db->models = NULL;
+    db->count = 0;
+    db->end = ZNET_PARAM_DB_DATA_OFFSET;
+    db->dirty = 0;
+    for( size_t i = 0; i <= ZNET_NODE_ID_MAX; i++ )
+        db->node_model[i] = -1;
+}
+
+static void _znet_param_db_dirty_params( znet_ctx_t* ctx,
+                                         znet_param_model_t* model,
+                                         uint16_t lo, uint16_t hi )
+{
+    if( model->dirty_lo >= model->dirty_hi )
+    {
+        model->dirty_lo = lo;
+        model->dirty_hi = hi;
+    }
+    else
+    {
+        if( lo < model->dirty_lo )
+            model->dirty_lo = lo;
+        if( hi > model->dirty_hi )
+            model->dirty_hi = hi;
+    }
+    znet_persist_touch( ctx );
+}
+
+static void _znet_param_db_dirty_model( znet_ctx_t* ctx,
+                                        znet_param_model_t* model )
+{
+    model->dirty = 1;
+    znet_persist_touch( ctx );
+}
+
+static void _znet_param_db_dirty_header( znet_ctx_t* ctx )
+{
+    ctx->param_db.dirty = 1;
+    znet_persist_touch( ctx );
+}
+
+/// INFO: a full region moves to the end with double capacity, the old one is
+/// left unused
+static void _znet_param_db_reserve( znet_ctx_t* ctx, znet_param_model_t* model )
+{
+    znet_param_db_t* db = &ctx->param_db;
+    if( model->count <= model->capacity )
+        return;
+
+    uint32_t capacity = model->capacity ? model->capacity : ZNET_PARAM_DB_CAPACITY_MIN;
+    while( capacity < model->count )
+        capacity *= 2;
+    if( capacity > UINT16_MAX )
+        capacity = UINT16_MAX;
+
+    model->capacity = (uint16_t)capacity;
+    model->offset = db->end;
+    db->end += capacity * sizeof( znet_param_meta_t );
+
+    _znet_param_db_dirty_params( ctx, model, 0, model->count );
+    _znet_param_db_dirty_model( ctx, model );
+    _znet_param_db_dirty_header( ctx );
+}
+
+static int _znet_param_db_load( znet_ctx_t* ctx )
+{
+    znet_param_db_t* db = &ctx->param_db;
+    const znet_callbacks_t* cb = ctx->cb;
+
+    znet_param_db_header_t header;
+    size_t offset = ZNET_STORE_PARAM_DB_OFFSET;
+    if( cb->store_load( offset, &header, sizeof( header ), cb->arg ) )
+        return -1;
+
+    /// INFO: nothing stored yet, older layouts are discovered again
+    if( header.magic != ZNET_PARAM_DB_MAGIC ||
+        header.version != ZNET_PARAM_DB_VERSION )
+        return 0;
+
+    if( header.count > ZNET_PARAM_DB_MODELS_MAX ||
+        header.end < ZNET_PARAM_DB_DATA_OFFSET )
+        return -1;
+
+    db->end = header.end;
+    offset = ZNET_PARAM_DB_DIR_OFFSET;
+    db->models = (znet_param_model_t*)_znet_param_db_alloc(
+        ctx, ZNET_MEM_TAG_PARAM_MODELS, NULL, header.count * sizeof( znet_param_model_t ) );
+    if( header.count && !db->models )
+        return -1;
+
+    for( uint16_t i = 0; i < header.count; i++ )
+    {
+        znet_param_db_model_header_t mh;
+        if( cb->store_load( offset, &mh, sizeof( mh ), cb->arg ) )
+            return -1;
+        offset += sizeof( mh );
+        if( mh.count > mh.capacity )
+            return -1;
+
+        znet_param_model_t* model = &db->models[db->count];
+        model->manufacturer_id = mh.manufacturer_id;
+        model->product_type = mh.product_type;
+        model->product_id = mh.product_id;
+        model->complete = mh.complete;
+        model->count = 0;
+        model->capacity = mh.capacity;
+        model->offset = mh.offset;
+        model->dirty = 0;
+        model->dirty_lo = 0;
+        model->dirty_hi = 0;
+        model->params = (znet_param_meta_t*)_znet_param_db_alloc(
+            ctx, ZNET_MEM_TAG_PARAM_PARAMS, NULL, mh.count * sizeof( znet_param_meta_t ) );
+        db->count++;
+        if( mh.count && !model->params )
+            return -1;
+
+        if( cb->store_load( mh.offset, model->params,
+                            mh.count * sizeof( znet_param_meta_t ), cb->arg ) )
+            return -1;
+        model->count = mh.count;
+    }
+
+    for( size_t i = 0; i <= ZNET_NODE_ID_MAX; i++ )
+        if( header.node_model[i] < db->count )
+            db->node_model[i] = header.node_model[i];
+
+    return 0;
+}
+
+void znet_param_db_init( znet_ctx_t* ctx )
+{
+    znet_param_db_t* db = &ctx->param_db;
+
+    db->models = NULL;
+    db->count = 0;
+    db->end = ZNET_PARAM_DB_DATA_OFFSET;
+    db->dirty = 0;
+    for( size_t i = 0; i <= ZNET_NODE_ID_MAX; i++ )
+        db->node_model[i] = -1;
+
+    if( _znet_param_db_load( ctx ) )
+    {
+        ZNET_LOGE( "ZNET: Parameters metadata is not loaded!\n" );
+        _znet_param_db_reset( ctx );
+    }
+}
+
+void znet_param_db_free( znet_ctx_t* ctx )
+{
+    _znet_param_db_reset( ctx );
+}
+
+static void _znet_param_db_entry( znet_param_db_model_header_t* mh,
+                                  const znet_param_model_t* model )
+{
+    memset( mh, 0, sizeof( znet_param_db_model_header_t ) );
+    mh->manufacturer_id = model->manufacturer_id;
+    mh->product_type = model->product_type;
+    mh->product_id = model->product_id;
+    mh->count = model->count;
+    mh->capacity = model->capacity;
+    mh->complete = model->complete;
+    mh->offset = model->offset;
+}
+
+int znet_param_db_flush( znet_ctx_t* ctx )
+{
+    znet_param_db_t* db = &ctx->param_db;
+    int ret = 0;
+
+    /// INFO: dirty parameters in parts that fit into one write
+    size_t chunk = znet_persist_chunk( ctx ) / sizeof( znet_param_meta_t );
+    for( uint16_t i = 0; i < db->count; i++ )
+    {
+        znet_param_model_t* model = &db->models[i];
+        while( model->dirty_lo < model->dirty_hi )
+        {
+            size_t count = model->dirty_hi - model->dirty_lo;
+            if( count > chunk )
+                count = chunk;
+
+            if( znet_persist_save( ctx, model->offset +
+                                       model->dirty_lo * sizeof( znet_param_meta_t ),
+                                   &model->params[model->dirty_lo],
+                                   count * sizeof( znet_param_meta_t ) ) )
+            {
+                ret = -1;
+                break;
+            }
+            model->dirty_lo += (uint16_t)count;
+        }
+        if( model->dirty_lo >= model->dirty_hi )
+        {
+            model->dirty_lo = 0;
+            model->dirty_hi = 0;
+        }
+    }
+
+    /// INFO: runs of adjacent directory entries; an entry publishes the
+    /// parameters of its model, it waits until they are all written (or
+    /// staged, the staging keeps the order)
+    znet_param_db_model_header_t run[ZNET_PARAM_DB_RUN_MAX];
+    uint16_t first = 0;
+    uint16_t n = 0;
+    for( uint16_t i = 0; i <= db->count; i++ )
+    {
+        int dirty = i < db->count && db->models[i].dirty &&
+                    db->models[i].dirty_lo >= db->models[i].dirty_hi;
+        if( n && ( !dirty || n == ZNET_PARAM_DB_RUN_MAX ) )
+        {
+            if( znet_persist_save( ctx, ZNET_PARAM_DB_DIR_OFFSET +
+                                       first * sizeof( run[0] ),
+                                   run, n * sizeof( run[0] ) ) )
+                ret = -1;
+            else
+                for( uint16_t j = first; j < first + n; j++ )
+                    db->models[j].dirty = 0;
+            n = 0;
+        }
+        if( !dirty )
+            continue;
+
+        if( !n )
+            first = i;
+        _znet_param_db_entry( &run[n++], &db->models[i] );
+    }
+
+    /// INFO: the header publishes the records, it must not get ahead of them
+    if( ret || !db->dirty )
+        return ret;
+
+    znet_param_db_header_t header;
+    memset( &header, 0, sizeof( header ) );
+    header.magic = ZNET_PARAM_DB_MAGIC;
+    header.version = ZNET_PARAM_DB_VERSION;
+    header.count = db->count;
+    header.end = db->end;
+    memcpy( header.node_model, db->node_model, sizeof( header.node_model ) );
+
+    if( znet_persist_save( ctx, ZNET_STORE_PARAM_DB_OFFSET, &header,
+                           sizeof( header ) ) )
+        return -1;
+    db->dirty = 0;
+    return 0;
+}
+
+void znet_param_db_dirty( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          const znet_param_meta_t* meta )
+{
+    znet_param_model_t* model = znet_param_db_model( ctx, node_id );
+    if( !model )
+        return;
+
+    if( !meta )
+    {
+        _znet_param_db_dirty_model( ctx, model );
+        return;
+    }
+
+    assert( meta >= model->params && meta < model->params + model->count );
+    uint16_t index = (uint16_t)( meta - model->params );
+    _znet_param_db_dirty_params( ctx, model, index, index + 1 );
+}
+
+znet_param_model_t* znet_param_db_model( znet_ctx_t* ctx,
+                                         znet_node_id_t node_id )
+{
+    znet_param_db_t* db = &ctx->param_db;
+
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX ||
+        db->node_model[node_id] < 0 )
+        return NULL;
+
+    return &db->models[db->node_model[node_id]];
+}
+
+znet_param_meta_t* znet_param_db_get( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                      znet_cmd_configuration_id_t param_number,
+                                      int create )
+{
+    znet_param_model_t* model = znet_param_db_model( ctx, node_id );
+    if( !model )
+        return NULL;
+
+    /// INFO: binary search of the insert position
+    uint16_t lo = 0;
+    uint16_t hi = model->count;
+    while( lo < hi )
+    {
+        uint16_t mid = lo + ( hi - lo ) / 2;
+        if( model->params[mid].param_number < param_number )
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if( lo < model->count && model->params[lo].param_number == param_number )
+        return &model->params[lo];
+
+    if( !create )
+        return NULL;
+
+    znet_param_meta_t* params = (znet_param_meta_t*)_znet_param_db_alloc(
+        ctx, ZNET_MEM_TAG_PARAM_PARAMS, model->params, ( model->count + 1 ) * sizeof( znet_param_meta_t ) );
+    if( !params )
+    {
+        ZNET_LOGE( "ZNET: No memory for parameter metadata!\n" );
+        return NULL;
+    }
+
+    memmove( &params[lo + 1], &params[lo],
+             ( model->count - lo ) * sizeof( znet_param_meta_t ) );
+    memset( &params[lo], 0, sizeof( znet_param_meta_t ) );
+    params[lo].param_number = param_number;
+
+    model->params = params;
+    model->count++;
+
+    /// INFO: the parameters after the new one moved
+    _znet_param_db_reserve( ctx, model );
+    _znet_param_db_dirty_params( ctx, model, lo, model->count );
+    _znet_param_db_dirty_model( ctx, model );
+    return &params[lo];
+}
+
+int32_t znet_param_db_value( const uint8_t* data, uint8_t size,
+                             uint8_t format )
+{
+    uint32_t value = 0;
+    for( uint8_t i = 0; i < size; i++ )
+        value = ( value << 8 ) | data[i];
+
+    if( format == ZNET_CMD_CONFIGURATION_FORMAT_SIGNED && size < 4 && size > 0 )
+    {
+        uint32_t sign = 1u << ( size * 8 - 1 );
+        value = ( value ^ sign ) - sign;
+    }
+    return (int32_t)value;
+}
+
+/// INFO: the byte order is known to GCC and Clang only, other compilers take
+/// the portable shifts
+#if defined( __GNUC__ ) && defined( __BYTE_ORDER__ ) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ZNET_PARAM_DB_BSWAP 1
+#elif defined( __GNUC__ ) && defined( __BYTE_ORDER__ ) && \
+    __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define ZNET_PARAM_DB_BSWAP 0
+#endif
+
+static inline uint32_t _znet_param_db_be32( uint32_t value )
+{
+#if !defined( ZNET_PARAM_DB_BSWAP )
+    uint8_t bytes[4];
+    memcpy( bytes, &value, sizeof( bytes ) );
+    return ( (uint32_t)bytes[0] << 24 ) | ( (uint32_t)bytes[1] << 16 ) |
+           ( (uint32_t)bytes[2] << 8 ) | bytes[3];
+#elif ZNET_PARAM_DB_BSWAP
+    return __builtin_bswap32( value );
+#else
+    return value;
+#endif
+}
+
+static inline uint16_t _znet_param_db_be16( uint16_t value )
+{
+#if !defined( ZNET_PARAM_DB_BSWAP )
+    uint8_t bytes[2];
+    memcpy( bytes, &value, sizeof( bytes ) );
+    return (uint16_t)( ( bytes[0] << 8 ) | bytes[1] );
+#elif ZNET_PARAM_DB_BSWAP
+    return __builtin_bswap16( value );
+#else
+    return value;
+#endif
+}
+
+void znet_param_db_values( const uint8_t* restrict data, uint8_t size,
+                           size_t count, uint32_t* restrict values )
+{
+    /// INFO: memcpy loads are unaligned safe and fold into plain loads
+    switch( size )
+    {
+    case 4:
+        for( size_t i = 0; i < count; i++ )
+        {
+            uint32_t value;
+            memcpy( &value, &data[i * 4], sizeof( value ) );
+            values[i] = _znet_param_db_be32( value );
+        }
+        break;
+    case 2:
+        for( size_t i = 0; i < count; i++ )
+        {
+            uint16_t value;
+            memcpy( &value, &data[i * 2], sizeof( value ) );
+            values[i] = _znet_param_db_be16( value );
+        }
+        break;
+    default:
+        for( size_t i = 0; i < count; i++ )
+            values[i] = data[i];
+        break;
+    }
+}
+
+void znet_param_db_text( char* text, size_t text_size, const uint8_t* data,
+                         size_t size, int first )
+{
+    assert( text_size );
+
+    size_t len = text_size - 1;
+    const char* end = first ? text : memchr( text, '\0', text_size - 1 );
+    if( end )
+        len = (size_t)( end - text );
+    if( size > text_size - 1 - len )
+        size = text_size - 1 - len;
+
+    memcpy( text + len, data, size );
+    text[len + size] = '\0';
+}
+
+int znet_ctx_param_db_bind( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            const znet_manufacturer_specific_report_t* value )
+{
+    if( !ctx || !value )
+        return -1;
+
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
+        return -1;
+
+    znet_param_db_t* db = &ctx->param_db;
+    int16_t index = -1;
+    for( uint16_t i = 0; i < db->count; i++ )
+    {
+        const znet_param_model_t* model = &db->models[i];
+        if( model->manufacturer_id == value->manufacturer_id &&
+            model->product_type == value->product_type &&
+            model->product_id == value->product_id )
+        {
+            index = (int16_t)i;
+            break;
+        }
+    }
+
+    if( index < 0 && db->count >= ZNET_PARAM_DB_MODELS_MAX )
+    {
+        ZNET_LOGE( "ZNET: No room for model metadata!\n" );
+        return -1;
+    }
+
+    if( index < 0 )
+    {
+        znet_param_model_t* models = (znet_param_model_t*)_znet_param_db_alloc(
+            ctx, ZNET_MEM_TAG_PARAM_MODELS, db->models, ( db->count + 1 ) * sizeof( znet_param_model_t ) );
+        if( !models )
+        {
+            ZNET_LOGE( "ZNET: No memory for model metadata!\n" );
+            return -1;
+        }
+
+        index = (int16_t)db->count;
+        models[index].manufacturer_id = value->manufacturer_id;
+        models[index].product_type = value->product_type;
+        models[index].product_id = value->product_id;
+        models[index].count = 0;
+        models[index].complete = 0;
+        models[index].params = NULL;
+        models[index].capacity = 0;
+        models[index].offset = 0;
+        models[index].dirty_lo = 0;
+        models[index].dirty_hi = 0;
+        db->models = models;
+        db->count++;
+        _znet_param_db_dirty_model( ctx, &models[index] );
+        _znet_param_db_dirty_header( ctx );
+    }
+
+    if( db->node_model[node_id] == index )
+        return 0;
+
+    db->node_model[node_id] = index;
+    _znet_param_db_dirty_header( ctx );
+    return 0;
+}
+
+int znet_ctx_param_db_lookup( znet_ctx_t* ctx, znet_node_id_t node_id,
+                              znet_cmd_configuration_id_t param_number,
+                              znet_param_meta_t* meta )
+{
+    if( !ctx || !meta )
+        return -1;
+
+    const znet_param_meta_t* it =
+        znet_param_db_get( ctx, node_id, param_number, 0 );
+    if( !it )
+        return -1;
+
+    *meta = *it;
+    meta->flags &= ZNET_PARAM_META_PROPERTIES | ZNET_PARAM_META_NAME |
+                   ZNET_PARAM_META_INFO;
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
@@ -0,0 +1,162 @@
+/**
+ * @file znet_param_db.h
+ * @date 18 Oct 2026
+ * @brief Configuration parameters metadata shared by identical device models.
+ */
+
+#ifndef ZNET_PARAM_DB_H
+#define ZNET_PARAM_DB_H
+
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Offset of the metadata database in the store
+ *
+ * Placed after the region used for the node cache.
+ */
+#define ZNET_STORE_PARAM_DB_OFFSET 0x10000
+
+#define ZNET_PARAM_DB_MAGIC 0x42445A50 /* "PZDB" */
+#define ZNET_PARAM_DB_VERSION 2
+
+/**
+ * @brief Max number of models, size of the model directory in the store
+ */
+#define ZNET_PARAM_DB_MODELS_MAX 64
+
+/**
+ * @brief Parameters region of model in the store: first capacity, it is
+ * doubled (and moved to the end) when full
+ */
+#define ZNET_PARAM_DB_CAPACITY_MIN 16
+
+/**
+ * @brief Name/Info reports to follow are expected
+ */
+#define ZNET_PARAM_META_NAME_PARTIAL 0x10
+#define ZNET_PARAM_META_INFO_PARTIAL 0x20
+
+/**
+ * @brief Metadata of one device model
+ */
+typedef struct znet_param_model_t
+{
+    uint16_t manufacturer_id; /**< Manufacturer ID */
+    uint16_t product_type;    /**< Product Type ID */
+    uint16_t product_id;      /**< Product ID */
+    uint16_t count;           /**< Parameters count */
+    uint8_t complete;         /**< flag: all parameters are discovered */
+    znet_param_meta_t* params; /**< Parameters, sorted by number */
+
+    uint16_t capacity; /**< Parameters region in the store */
+    uint32_t offset;   /**< Offset of parameters region in the store */
+    uint8_t dirty;     /**< flag: directory entry is not stored */
+    uint16_t dirty_lo; /**< Parameters [lo, hi) are not stored */
+    uint16_t dirty_hi;
+} znet_param_model_t;
+
+/**
+ * @brief Metadata database of the context
+ */
+typedef struct znet_param_db_t
+{
+    uint16_t count;              /**< Models count */
+    znet_param_model_t* models;  /**< Models */
+    int16_t node_model[ZNET_NODE_ID_MAX + 1]; /**< Model index, -1 unknown */
+    uint32_t end;                /**< End of used store region */
+    uint8_t dirty;               /**< flag: header is not stored */
+} znet_param_db_t;
+
+/**
+ * @brief Init empty database and load it from the store
+ */
+void znet_param_db_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Release database memory
+ */
+void znet_param_db_free( znet_ctx_t* ctx );
+
+/**
+ * @brief Mark metadata of parameter (or the model) of node as changed
+ *
+ * The record is written by the next flush of the store.
+ *
+ * @param meta Parameter of the model of node, NULL - model itself
+ */
+void znet_param_db_dirty( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          const znet_param_meta_t* meta );
+
+/**
+ * @brief Write changed records to the store
+ *
+ * Parameters and directory entries go first, the header that publishes them
+ * last. Adjacent records are written at once.
+ *
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_param_db_flush( znet_ctx_t* ctx );
+
+/**
+ * @brief Get model of node
+ *
+ * @return Model or NULL if the model of node is unknown
+ */
+znet_param_model_t* znet_param_db_model( znet_ctx_t* ctx,
+                                         znet_node_id_t node_id );
+
+/**
+ * @brief Find metadata of parameter for the model of node
+ *
+ * @param create Add empty entry if not found
+ * @return Metadata or NULL if the model of node is unknown
+ */
+znet_param_meta_t* znet_param_db_get( znet_ctx_t* ctx, znet_node_id_t node_id,
+                                      znet_cmd_configuration_id_t param_number,
+                                      int create );
+
+/**
+ * @brief Decode big-endian value of configuration parameter
+ *
+ * @param data Value
+ * @param size Size of value (1, 2 or 4)
+ * @param format ZNET_CMD_CONFIGURATION_FORMAT_*, signed values are sign
+ * extended
+ */
+int32_t znet_param_db_value( const uint8_t* data, uint8_t size,
+                             uint8_t format );
+
+/**
+ * @brief Decode array of big-endian values of the same size, zero extended
+ *
+ * Kernels of fixed width, the byte swap loops are vectorized by the compiler.
+ *
+ * @param data Values
+ * @param size Size of value (1, 2 or 4)
+ * @param count Number of values
+ * @param values Decoded values
+ */
+void znet_param_db_values( const uint8_t* data, uint8_t size, size_t count,
+                           uint32_t* values );
+
+/**
+ * @brief Append text of Name/Info report to metadata string
+ *
+ * @param text Metadata string, zero terminated
+ * @param text_size Size of metadata string buffer
+ * @param first First report of the sequence, the string is reset
+ */
+void znet_param_db_text( char* text, size_t text_size, const uint8_t* data,
+                         size_t size, int first );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_PARAM_DB_H
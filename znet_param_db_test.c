@@ -0,0 +1,182 @@
+/**
+ * @file znet_param_db_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of the order of parameters metadata writes.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_param_db_test.c -o znet_param_db_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_param_db.c"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+#define TEST_WRITES_MAX 32
+
+/// INFO: kind of record by its offset in the store
+#define TEST_HEADER 0
+#define TEST_DIR 1
+#define TEST_PARAMS 2
+
+static struct
+{
+    size_t offsets[TEST_WRITES_MAX];
+    size_t sizes[TEST_WRITES_MAX];
+    size_t count;
+    size_t fail_offset; /**< Writes at this offset fail, 0 - none */
+} test;
+
+static int _test_store_load( size_t offset, void* data, size_t size, void* arg )
+{
+    (void)offset;
+    (void)data;
+    (void)size;
+    (void)arg;
+    return -1;
+}
+
+static int _test_kind( size_t offset )
+{
+    if( offset < ZNET_PARAM_DB_DIR_OFFSET )
+        return TEST_HEADER;
+    if( offset < ZNET_PARAM_DB_DATA_OFFSET )
+        return TEST_DIR;
+    return TEST_PARAMS;
+}
+
+int znet_persist_save( znet_ctx_t* ctx, size_t offset, const void* data,
+                       size_t size )
+{
+    (void)ctx;
+    (void)data;
+    if( test.fail_offset && offset == test.fail_offset )
+        return -1;
+
+    assert( test.count < TEST_WRITES_MAX );
+    test.offsets[test.count] = offset;
+    test.sizes[test.count] = size;
+    test.count++;
+    return 0;
+}
+
+size_t znet_persist_chunk( znet_ctx_t* ctx )
+{
+    (void)ctx;
+    return SIZE_MAX;
+}
+
+void znet_persist_touch( znet_ctx_t* ctx )
+{
+    (void)ctx;
+}
+
+void* znet_mem_alloc( znet_ctx_t* ctx, znet_mem_tag_t tag, void* ptr, size_t size )
+{
+    (void)ctx;
+    (void)tag;
+    if( !size )
+    {
+        free( ptr );
+        return NULL;
+    }
+    return realloc( ptr, size );
+}
+
+static const znet_callbacks_t _test_cb = { .store_load = _test_store_load };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_param_db_init( &_test_ctx );
+    return &_test_ctx;
+}
+
+static void _test_model( znet_ctx_t* ctx, znet_node_id_t node_id,
+                         uint16_t product_id )
+{
+    znet_manufacturer_specific_report_t report;
+    memset( &report, 0, sizeof( report ) );
+    report.manufacturer_id = 1;
+    report.product_type = 2;
+    report.product_id = product_id;
+    assert( !znet_ctx_param_db_bind( ctx, node_id, &report ) );
+    assert( znet_param_db_get( ctx, node_id, 1, 1 ) );
+    assert( znet_param_db_get( ctx, node_id, 2, 1 ) );
+}
+
+/// INFO: parameters, then directory, then the header that publishes them
+static void _test_order( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    _test_model( ctx, 5, 10 );
+
+    assert( !znet_param_db_flush( ctx ) );
+    assert( test.count == 3 );
+    assert( _test_kind( test.offsets[0] ) == TEST_PARAMS );
+    assert( _test_kind( test.offsets[1] ) == TEST_DIR );
+    assert( _test_kind( test.offsets[2] ) == TEST_HEADER );
+
+    /// INFO: nothing is dirty anymore
+    test.count = 0;
+    assert( !znet_param_db_flush( ctx ) );
+    assert( test.count == 0 );
+    znet_param_db_free( ctx );
+}
+
+/// INFO: the entry of a model with unwritten parameters waits for them, the
+/// entries of other models go
+static void _test_dir_waits( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    _test_model( ctx, 5, 10 );
+    _test_model( ctx, 6, 11 );
+
+    const znet_param_model_t* first = znet_param_db_model( ctx, 5 );
+    const znet_param_model_t* second = znet_param_db_model( ctx, 6 );
+    test.fail_offset = first->offset;
+
+    assert( znet_param_db_flush( ctx ) == -1 );
+    assert( test.count == 2 );
+    assert( test.offsets[0] == second->offset );
+    assert( test.offsets[1] == ZNET_PARAM_DB_DIR_OFFSET +
+                                   sizeof( znet_param_db_model_header_t ) );
+    assert( first->dirty && !second->dirty && ctx->param_db.dirty );
+
+    /// INFO: the next flush writes the rest in order
+    test.fail_offset = 0;
+    test.count = 0;
+    assert( !znet_param_db_flush( ctx ) );
+    assert( test.count == 3 );
+    assert( test.offsets[0] == first->offset );
+    assert( test.offsets[1] == ZNET_PARAM_DB_DIR_OFFSET );
+    assert( _test_kind( test.offsets[2] ) == TEST_HEADER );
+    assert( !first->dirty && !ctx->param_db.dirty );
+    znet_param_db_free( ctx );
+}
+
+int main( void )
+{
+    _test_order();
+    _test_dir_waits();
+    printf( "znet_param_db_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
@@ -0,0 +1,396 @@
+/**
+ * @file znet_persist.c
+ * @date 18 Oct 2026
+ * @brief Write-back of dirty records to the store.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_persist.h"
+#include "znet_param_db.h"
+
+/// INFO: header of write in staging buffer, data follows
+typedef struct znet_persist_write_t
+{
+    uint32_t offset;
+    uint32_t size;
+} znet_persist_write_t;
+
+static int _znet_persist_put( znet_ctx_t* ctx, size_t offset, const void* data,
+                              size_t size )
+{
+    const znet_callbacks_t* cb = ctx->cb;
+    return cb->store_save( offset, data, size, cb->arg );
+}
+
+static void _znet_persist_batch_reset( struct znet_store_batch_t* batch )
+{
+    batch->count = 0;
+    batch->used = 0;
+    atomic_store_explicit( &batch->state, ZNET_PERSIST_BATCH_FILLING,
+                           memory_order_relaxed );
+}
+
+static void _znet_persist_submit( znet_ctx_t* ctx )
+{
+    znet_persist_t* persist = &ctx->persist;
+    struct znet_store_batch_t* batch = &persist->stage[persist->fill];
+
+    assert( !persist->running );
+    persist->running = batch;
+    persist->fill ^= 1;
+    atomic_store_explicit( &batch->state, ZNET_PERSIST_BATCH_RUNNING,
+                           memory_order_release );
+    ctx->cb->store_executor( batch, ctx->cb->arg );
+}
+
+static void _znet_persist_retry( znet_ctx_t* ctx,
+                                 struct znet_store_batch_t* batch )
+{
+    batch->fail_time = 0;
+    atomic_store_explicit( &batch->state, ZNET_PERSIST_BATCH_RUNNING,
+                           memory_order_release );
+    ctx->cb->store_executor( batch, ctx->cb->arg );
+}
+
+/// INFO: the executor holds the buffer, it is part of the context; without
+/// store_wait it finishes on its own thread, this one gives way meanwhile
+static int _znet_persist_wait( znet_ctx_t* ctx, struct znet_store_batch_t* batch )
+{
+    int state = atomic_load_explicit( &batch->state, memory_order_acquire );
+    if( state == ZNET_PERSIST_BATCH_RUNNING && ctx->cb->store_wait )
+    {
+        ctx->cb->store_wait( batch, ctx->cb->arg );
+        state = atomic_load_explicit( &batch->state, memory_order_acquire );
+    }
+#ifndef __STDC_NO_THREADS__
+    while( state == ZNET_PERSIST_BATCH_RUNNING )
+    {
+        thrd_yield();
+        state = atomic_load_explicit( &batch->state, memory_order_acquire );
+    }
+#endif
+    return state;
+}
+
+/// INFO: the next buffer goes only after the previous one is written, so the
+/// store sees the writes in order
+static void _znet_persist_async_proc( znet_ctx_t* ctx, uint64_t now )
+{
+    znet_persist_t* persist = &ctx->persist;
+    struct znet_store_batch_t* batch = persist->running;
+
+    if( batch )
+    {
+        int state = atomic_load_explicit( &batch->state, memory_order_acquire );
+        if( state == ZNET_PERSIST_BATCH_RUNNING )
+            return;
+
+        if( state == ZNET_PERSIST_BATCH_FAILED )
+        {
+            /// INFO: the same buffer is written again after debounce
+            if( !batch->fail_time )
+            {
+                persist->errors++;
+                batch->fail_time = now;
+                ZNET_LOGE( "ZNET: Store write failed!\n" );
+            }
+            if( now - batch->fail_time < persist->debounce_ms )
+                return;
+
+            _znet_persist_retry( ctx, batch );
+            return;
+        }
+
+        persist->writes += batch->count;
+        persist->bytes += batch->used - batch->count * sizeof( znet_persist_write_t );
+        _znet_persist_batch_reset( batch );
+        persist->running = NULL;
+    }
+
+    if( persist->stage[persist->fill].count )
+        _znet_persist_submit( ctx );
+}
+
+void znet_persist_init( znet_ctx_t* ctx )
+{
+    znet_persist_t* persist = &ctx->persist;
+
+    memset( persist, 0, sizeof( znet_persist_t ) );
+    persist->mode = ZNET_STORE_MODE_SYNC;
+    persist->debounce_ms = ZNET_PERSIST_DEBOUNCE_MS;
+    persist->delay_max_ms = ZNET_PERSIST_DELAY_MAX_MS;
+    for( size_t i = 0; i < 2; i++ )
+    {
+        persist->stage[i].ctx = ctx;
+        atomic_init( &persist->stage[i].state, ZNET_PERSIST_BATCH_FILLING );
+    }
+}
+
+void znet_persist_touch( znet_ctx_t* ctx )
+{
+    znet_persist_t* persist = &ctx->persist;
+
+    persist->last = ctx->cb->clock( ctx->cb->arg );
+    if( !persist->dirty )
+        persist->first = persist->last;
+    persist->dirty = 1;
+}
+
+void znet_persist_proc( znet_ctx_t* ctx )
+{
+    znet_persist_t* persist = &ctx->persist;
+    if( !persist->dirty && !persist->running )
+        return;
+
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    if( persist->mode == ZNET_STORE_MODE_ASYNC )
+        _znet_persist_async_proc( ctx, now );
+
+    /// INFO: a burst of changes (discovery) is written once
+    if( !persist->dirty ||
+        ( now - persist->last < persist->debounce_ms &&
+          now - persist->first < persist->delay_max_ms ) )
+        return;
+
+    if( znet_persist_flush( ctx ) )
+    {
+        /// INFO: retry after the next debounce interval
+        persist->dirty = 1;
+        persist->first = now;
+        persist->last = now;
+    }
+
+    if( persist->mode == ZNET_STORE_MODE_ASYNC && !persist->running &&
+        persist->stage[persist->fill].count )
+        _znet_persist_submit( ctx );
+}
+
+int znet_persist_flush( znet_ctx_t* ctx )
+{
+    znet_persist_t* persist = &ctx->persist;
+    int ret = 0;
+
+    persist->dirty = 0;
+#if ZNET_CFG_CC_CONFIGURATION
+    if( znet_param_db_flush( ctx ) )
+        ret = -1;
+#endif
+
+    /// INFO: no room in the filling buffer is no error, the rest waits
+    if( ret && persist->mode == ZNET_STORE_MODE_SYNC )
+        ZNET_LOGE( "ZNET: Store flush failed!\n" );
+    else if( !ret )
+        persist->flushes++;
+    return ret;
+}
+
+int znet_persist_save( znet_ctx_t* ctx, size_t offset, const void* data,
+                       size_t size )
+{
+    znet_persist_t* persist = &ctx->persist;
+
+    if( persist->mode == ZNET_STORE_MODE_SYNC )
+    {
+        if( _znet_persist_put( ctx, offset, data, size ) )
+        {
+            persist->errors++;
+            return -1;
+        }
+        persist->writes++;
+        persist->bytes += (uint32_t)size;
+        return 0;
+    }
+
+    struct znet_store_batch_t* batch = &persist->stage[persist->fill];
+    znet_persist_write_t write = { .offset = (uint32_t)offset,
+                                   .size = (uint32_t)size };
+    if( sizeof( write ) + size > ZNET_PERSIST_STAGE_SIZE - batch->used )
+        return -1;
+
+    memcpy( &batch->data[batch->used], &write, sizeof( write ) );
+    memcpy( &batch->data[batch->used + sizeof( write )], data, size );
+    batch->used += (uint32_t)( sizeof( write ) + size );
+    batch->count++;
+    return 0;
+}
+
+size_t znet_persist_chunk( znet_ctx_t* ctx )
+{
+    if( ctx->persist.mode == ZNET_STORE_MODE_SYNC )
+        return SIZE_MAX;
+    return ZNET_PERSIST_STAGE_SIZE - sizeof( znet_persist_write_t );
+}
+
+void znet_persist_free( znet_ctx_t* ctx )
+{
+    znet_persist_t* persist = &ctx->persist;
+
+    if( persist->running )
+    {
+        struct znet_store_batch_t* batch = persist->running;
+        int state = _znet_persist_wait( ctx, batch );
+        if( state == ZNET_PERSIST_BATCH_FAILED )
+        {
+            znet_store_batch_run( batch );
+            state = atomic_load_explicit( &batch->state, memory_order_acquire );
+        }
+        persist->running = NULL;
+
+        /// INFO: later writes may publish records of the failed batch
+        if( state == ZNET_PERSIST_BATCH_FAILED )
+        {
+            persist->errors++;
+            ZNET_LOGE( "ZNET: Store write failed, later writes are dropped!\n" );
+            return;
+        }
+    }
+
+    if( persist->mode == ZNET_STORE_MODE_ASYNC )
+    {
+        struct znet_store_batch_t* batch = &persist->stage[persist->fill];
+        if( batch->count )
+            znet_store_batch_run( batch );
+        persist->mode = ZNET_STORE_MODE_SYNC;
+    }
+
+    if( persist->dirty )
+        znet_persist_flush( ctx );
+}
+
+void znet_store_batch_run( znet_store_batch_t* batch )
+{
+    assert( batch );
+
+    int state = ZNET_PERSIST_BATCH_DONE;
+    uint32_t pos = 0;
+    for( uint32_t i = 0; i < batch->count; i++ )
+    {
+        znet_persist_write_t write;
+        memcpy( &write, &batch->data[pos], sizeof( write ) );
+        pos += sizeof( write );
+        if( _znet_persist_put( batch->ctx, write.offset, &batch->data[pos],
+                               write.size ) )
+        {
+            state = ZNET_PERSIST_BATCH_FAILED;
+            break;
+        }
+        pos += write.size;
+    }
+
+    atomic_store_explicit( &batch->state, state, memory_order_release );
+}
+
+int znet_ctx_store_mode( znet_ctx_t* ctx, int mode )
+{
+    if( !ctx )
+        return -1;
+
+    if( mode == ZNET_STORE_MODE_ASYNC && !ctx->cb->store_executor )
+    {
+        ZNET_LOGE( "ZNET: Store executor is not set!\n" );
+        return -1;
+    }
+#ifdef __STDC_NO_THREADS__
+    /// INFO: nothing else can wait for the executor
+    if( mode == ZNET_STORE_MODE_ASYNC && !ctx->cb->store_wait )
+    {
+        ZNET_LOGE( "ZNET: Store wait is not set!\n" );
+        return -1;
+    }
+#endif
+
+    if( mode != ZNET_STORE_MODE_SYNC && mode != ZNET_STORE_MODE_ASYNC )
+        return -1;
+
+    /// INFO: synchronous writes must not overtake staged ones
+    znet_persist_t* persist = &ctx->persist;
+    if( persist->running || persist->stage[persist->fill].count )
+    {
+        ZNET_LOGE( "ZNET: Store writes are pending, mode is not changed!\n" );
+        return -1;
+    }
+
+    persist->mode = mode;
+    return 0;
+}
+
+int znet_ctx_store_debounce( znet_ctx_t* ctx, uint32_t debounce_ms,
+                             uint32_t delay_max_ms )
+{
+    if( !ctx || delay_max_ms < debounce_ms )
+        return -1;
+
+    ctx->persist.debounce_ms = debounce_ms;
+    ctx->persist.delay_max_ms = delay_max_ms;
+    return 0;
+}
+
+int znet_ctx_store_flush( znet_ctx_t* ctx )
+{
+    if( !ctx )
+        return -1;
+
+    znet_persist_t* persist = &ctx->persist;
+    if( persist->mode == ZNET_STORE_MODE_SYNC )
+    {
+        if( persist->dirty && znet_persist_flush( ctx ) )
+        {
+            znet_persist_touch( ctx );
+            return -1;
+        }
+        return 0;
+    }
+
+    /// INFO: records without room in the filling buffer are staged once the
+    /// buffer being written is done, until all are handed over
+    for( ;; )
+    {
+        if( persist->dirty && znet_persist_flush( ctx ) )
+            znet_persist_touch( ctx );
+        if( !persist->running && persist->stage[persist->fill].count )
+            _znet_persist_submit( ctx );
+        if( !persist->dirty )
+            return 0;
+        if( !persist->running )
+            return -1;
+
+        /// INFO: a failed buffer is written again now, not after debounce
+        struct znet_store_batch_t* batch = persist->running;
+        if( atomic_load_explicit( &batch->state, memory_order_acquire ) ==
+            ZNET_PERSIST_BATCH_FAILED )
+            _znet_persist_retry( ctx, batch );
+
+        int state = _znet_persist_wait( ctx, batch );
+        _znet_persist_async_proc( ctx, ctx->cb->clock( ctx->cb->arg ) );
+        if( state == ZNET_PERSIST_BATCH_FAILED )
+            return -1;
+    }
+}
+
+void znet_ctx_store_stats( znet_ctx_t* ctx, znet_store_stats_t* stats )
+{
+    if( !ctx || !stats )
+        return;
+
+    const znet_persist_t* persist = &ctx->persist;
+    stats->dirty = persist->dirty;
+    stats->writes = persist->writes;
+    stats->bytes = persist->bytes;
+    stats->flushes = persist->flushes;
+    stats->errors = persist->errors;
+    stats->pending = persist->stage[persist->fill].used;
+    if( persist->running )
+        stats->pending += persist->running->used;
+}
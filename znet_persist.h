@@ -0,0 +1,138 @@
+/**
+ * @file znet_persist.h
+ * @date 18 Oct 2026
+ * @brief Write-back of dirty records to the store.
+ */
+
+#ifndef ZNET_PERSIST_H
+#define ZNET_PERSIST_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Default quiet time after the last change before flush (ms)
+ */
+#define ZNET_PERSIST_DEBOUNCE_MS 2000
+
+/**
+ * @brief Default max time a change waits for flush (ms)
+ */
+#define ZNET_PERSIST_DELAY_MAX_MS 10000
+
+/**
+ * @brief Size of staging buffer of async mode, bounds one write
+ */
+#define ZNET_PERSIST_STAGE_SIZE 4096
+
+/**
+ * @brief State of staging buffer
+ */
+#define ZNET_PERSIST_BATCH_FILLING 0 /**< Library appends writes */
+#define ZNET_PERSIST_BATCH_RUNNING 1 /**< Handed over to store_executor */
+#define ZNET_PERSIST_BATCH_DONE 2    /**< All writes succeeded */
+#define ZNET_PERSIST_BATCH_FAILED 3  /**< A write failed */
+
+/**
+ * @brief Staging buffer: writes serialized as offset, size, data
+ */
+struct znet_store_batch_t
+{
+    znet_ctx_t* ctx;             /**< Owner */
+    atomic_int state;            /**< ZNET_PERSIST_BATCH_* */
+    uint32_t count;              /**< Writes */
+    uint32_t used;               /**< Bytes used in data */
+    uint64_t fail_time;          /**< Time of failure (ms) */
+    uint8_t data[ZNET_PERSIST_STAGE_SIZE];
+};
+
+/**
+ * @brief Write-back state of the context
+ *
+ * Modules mark their records dirty and call znet_persist_touch. The flush
+ * writes the dirty records of every module once the changes settle.
+ *
+ * In async mode the flush serializes the records into the filling buffer,
+ * the other buffer is written by store_executor meanwhile. Buffers are
+ * written one after another in the order they were filled.
+ */
+typedef struct znet_persist_t
+{
+    int mode;              /**< ZNET_STORE_MODE_* */
+    uint8_t dirty;         /**< flag: records wait for flush */
+    uint32_t debounce_ms;  /**< Quiet time before flush */
+    uint32_t delay_max_ms; /**< Max wait of the first change */
+    uint64_t first;        /**< Time of first change since flush (ms) */
+    uint64_t last;         /**< Time of last change (ms) */
+
+    uint32_t writes;  /**< Calls of store_save */
+    uint32_t bytes;   /**< Bytes written */
+    uint32_t flushes; /**< Flushes done */
+    uint32_t errors;  /**< Failed writes */
+
+    struct znet_store_batch_t stage[2]; /**< Staging buffers (async) */
+    uint8_t fill;                       /**< Index of filling buffer */
+    struct znet_store_batch_t* running; /**< Buffer being written, or NULL */
+} znet_persist_t;
+
+/**
+ * @brief Init clean state with default timers
+ */
+void znet_persist_init( znet_ctx_t* ctx );
+
+/**
+ * @brief A record was marked dirty, (re)start the debounce timer
+ */
+void znet_persist_touch( znet_ctx_t* ctx );
+
+/**
+ * @brief Flush when the changes settled or waited too long
+ */
+void znet_persist_proc( znet_ctx_t* ctx );
+
+/**
+ * @brief Write dirty records of all modules now
+ *
+ * @return Return zero on success. On error, -1 is returned, the records stay
+ * dirty and are written by the next flush
+ */
+int znet_persist_flush( znet_ctx_t* ctx );
+
+/**
+ * @brief Write record (or adjacent records) to the store
+ *
+ * In async mode the record is copied into the filling buffer.
+ *
+ * @param size Size of record, at most znet_persist_chunk
+ * @return Return zero on success. On error (or no room in the filling
+ * buffer), -1 is returned
+ */
+int znet_persist_save( znet_ctx_t* ctx, size_t offset, const void* data,
+                       size_t size );
+
+/**
+ * @brief Get max size of one write, bigger records are written in parts
+ */
+size_t znet_persist_chunk( znet_ctx_t* ctx );
+
+/**
+ * @brief Wait for the buffer being written and write the rest synchronously
+ *
+ * Called before the context is released. Waits through store_wait if it is
+ * set, else yields until the executor thread finishes the buffer. A failed
+ * buffer is written once more; if that fails, the later writes are dropped.
+ */
+void znet_persist_free( znet_ctx_t* ctx );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_PERSIST_H
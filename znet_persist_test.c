@@ -0,0 +1,182 @@
+/**
+ * @file znet_persist_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of staged writes to the store.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_persist_test.c -o znet_persist_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_persist.c"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+#define TEST_RECORDS 5
+#define TEST_RECORD_SIZE 1500
+#define TEST_WRITES_MAX 16
+
+static struct
+{
+    size_t records;    /**< Records to write */
+    size_t staged;     /**< Records handed to znet_persist_save */
+    size_t offsets[TEST_WRITES_MAX];
+    size_t count;      /**< Writes done */
+    int fail;          /**< flag: store_save fails */
+    znet_store_batch_t* queued; /**< Batch waiting for the executor */
+    uint8_t record[TEST_RECORD_SIZE];
+} test;
+
+int znet_param_db_flush( znet_ctx_t* ctx )
+{
+    for( ; test.staged < test.records; test.staged++ )
+    {
+        if( znet_persist_save( ctx, test.staged * TEST_RECORD_SIZE,
+                               test.record, TEST_RECORD_SIZE ) )
+            return -1;
+    }
+    return 0;
+}
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return 1000;
+}
+
+static int _test_store_save( size_t offset, const void* data, size_t size,
+                             void* arg )
+{
+    (void)data;
+    (void)arg;
+    assert( size == TEST_RECORD_SIZE );
+    if( test.fail )
+        return -1;
+    assert( test.count < TEST_WRITES_MAX );
+    test.offsets[test.count++] = offset;
+    return 0;
+}
+
+static void _test_store_executor( znet_store_batch_t* batch, void* arg )
+{
+    (void)arg;
+    assert( !test.queued );
+    test.queued = batch;
+}
+
+static void _test_store_wait( znet_store_batch_t* batch, void* arg )
+{
+    (void)arg;
+    assert( test.queued == batch );
+    test.queued = NULL;
+    znet_store_batch_run( batch );
+}
+
+static const znet_callbacks_t _test_cb = {
+    .clock = _test_clock,
+    .store_save = _test_store_save,
+    .store_executor = _test_store_executor,
+    .store_wait = _test_store_wait };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( size_t records )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_persist_init( &_test_ctx );
+    assert( !znet_ctx_store_mode( &_test_ctx, ZNET_STORE_MODE_ASYNC ) );
+    test.records = records;
+    znet_persist_touch( &_test_ctx );
+    return &_test_ctx;
+}
+
+static void _test_written( size_t count )
+{
+    assert( test.count == count );
+    for( size_t i = 0; i < count; i++ )
+        assert( test.offsets[i] == i * TEST_RECORD_SIZE );
+}
+
+/// INFO: the records without room wait for the buffer being written, then
+/// they are staged too
+static void _test_flush_rest( void )
+{
+    znet_ctx_t* ctx = _test_setup( TEST_RECORDS );
+    assert( TEST_RECORDS * TEST_RECORD_SIZE > ZNET_PERSIST_STAGE_SIZE );
+
+    assert( !znet_ctx_store_flush( ctx ) );
+    assert( !ctx->persist.dirty && test.staged == TEST_RECORDS );
+    assert( test.queued && ctx->persist.running == test.queued );
+    _test_written( TEST_RECORDS - 1 );
+
+    znet_store_batch_run( test.queued );
+    test.queued = NULL;
+    _test_written( TEST_RECORDS );
+    znet_persist_free( ctx );
+}
+
+/// INFO: a failed batch fails the flush, the records stay dirty
+static void _test_flush_failed( void )
+{
+    znet_ctx_t* ctx = _test_setup( TEST_RECORDS );
+    test.fail = 1;
+    assert( znet_ctx_store_flush( ctx ) == -1 );
+    assert( ctx->persist.dirty && ctx->persist.errors == 1 );
+
+    /// INFO: the failed batch is retried first
+    test.fail = 0;
+    assert( !znet_ctx_store_flush( ctx ) );
+    znet_persist_free( ctx );
+    _test_written( TEST_RECORDS );
+}
+
+/// INFO: at release a failed batch is retried once, the later writes go only
+/// after it
+static void _test_free( int fail )
+{
+    znet_ctx_t* ctx = _test_setup( 3 );
+    test.fail = 1;
+    assert( znet_ctx_store_flush( ctx ) == -1 );
+    assert( test.staged == 2 );
+
+    /// INFO: the rest is staged behind the failed batch
+    assert( !znet_persist_flush( ctx ) );
+    assert( test.staged == 3 && ctx->persist.stage[ctx->persist.fill].count );
+
+    test.fail = fail;
+    znet_persist_free( ctx );
+    if( fail )
+    {
+        _test_written( 0 );
+        assert( ctx->persist.errors == 2 );
+    }
+    else
+    {
+        _test_written( 3 );
+    }
+}
+
+int main( void )
+{
+    _test_flush_rest();
+    _test_flush_failed();
+    _test_free( 1 );
+    _test_free( 0 );
+    printf( "znet_persist_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
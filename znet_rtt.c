@@ -0,0 +1,107 @@
+/**
+ * @file znet_rtt.c
+ * @date 18 Oct 2026
+ * @brief Round-trip time of nodes and timeouts derived from it.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_rtt.h"
+
+static znet_rtt_t* _znet_rtt_node( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
+        return NULL;
+    return &ctx->rtt[node_id];
+}
+
+void znet_rtt_init( znet_ctx_t* ctx )
+{
+    for( size_t i = 0; i <= ZNET_NODE_ID_MAX; i++ )
+    {
+        memset( &ctx->rtt[i], 0, sizeof( znet_rtt_t ) );
+        ctx->rtt[i].rto = ZNET_RTT_INITIAL_MS;
+    }
+}
+
+/// INFO: RFC 6298 with gains 1/8 and 1/4
+void znet_rtt_sample( znet_ctx_t* ctx, znet_node_id_t node_id, uint32_t rtt_ms )
+{
+    znet_rtt_t* rtt = _znet_rtt_node( ctx, node_id );
+    if( !rtt )
+        return;
+
+    if( rtt_ms == 0 )
+        rtt_ms = 1;
+
+    if( rtt->srtt8 == 0 )
+    {
+        rtt->srtt8 = rtt_ms << 3;
+        rtt->rttvar4 = rtt_ms << 1;
+    }
+    else
+    {
+        int32_t delta = (int32_t)rtt_ms - (int32_t)( rtt->srtt8 >> 3 );
+        rtt->srtt8 = (uint32_t)( (int32_t)rtt->srtt8 + delta );
+        if( delta < 0 )
+            delta = -delta;
+        rtt->rttvar4 = (uint32_t)( (int32_t)rtt->rttvar4 + delta -
+                                   (int32_t)( rtt->rttvar4 >> 2 ) );
+    }
+
+    uint32_t rto = ( rtt->srtt8 >> 3 ) + rtt->rttvar4;
+    if( rto < ZNET_RTT_MIN_MS )
+        rto = ZNET_RTT_MIN_MS;
+    if( rto > ZNET_RTT_MAX_MS )
+        rto = ZNET_RTT_MAX_MS;
+
+    rtt->rto = rto;
+    rtt->backoff = 0;
+    rtt->samples++;
+}
+
+void znet_rtt_loss( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    znet_rtt_t* rtt = _znet_rtt_node( ctx, node_id );
+    if( !rtt )
+        return;
+
+    if( rtt->backoff < ZNET_RTT_BACKOFF_MAX )
+        rtt->backoff++;
+}
+
+uint32_t znet_rtt_timeout( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    const znet_rtt_t* rtt = _znet_rtt_node( ctx, node_id );
+    if( !rtt )
+        return ZNET_RTT_INITIAL_MS;
+
+    uint32_t timeout = rtt->rto << rtt->backoff;
+    return timeout > ZNET_RTT_MAX_MS ? ZNET_RTT_MAX_MS : timeout;
+}
+
+int znet_ctx_node_rtt( znet_ctx_t* ctx, znet_node_id_t node_id,
+                       znet_node_rtt_t* stats )
+{
+    if( !ctx || !stats )
+        return -1;
+
+    const znet_rtt_t* rtt = _znet_rtt_node( ctx, node_id );
+    if( !rtt )
+        return -1;
+
+    stats->srtt = rtt->srtt8 >> 3;
+    stats->rttvar = rtt->rttvar4 >> 2;
+    stats->timeout = znet_rtt_timeout( ctx, node_id );
+    stats->backoff = rtt->backoff;
+    stats->samples = rtt->samples;
+    return 0;
+}
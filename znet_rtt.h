@@ -0,0 +1,75 @@
+/**
+ * @file znet_rtt.h
+ * @date 18 Oct 2026
+ * @brief Round-trip time of nodes and timeouts derived from it.
+ */
+
+#ifndef ZNET_RTT_H
+#define ZNET_RTT_H
+
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Timeout of node without samples (ms)
+ */
+#define ZNET_RTT_INITIAL_MS 5000
+
+/**
+ * @brief Bounds of timeout (ms)
+ */
+#define ZNET_RTT_MIN_MS 250
+#define ZNET_RTT_MAX_MS 30000
+
+/**
+ * @brief Max backoff: timeout is doubled on every loss up to 2^N times
+ */
+#define ZNET_RTT_BACKOFF_MAX 3
+
+/**
+ * @brief Round-trip statistics of one node
+ *
+ * Smoothed RTT and its variation are kept scaled by 8 and 4 like in TCP, so
+ * integer math keeps the fraction.
+ */
+typedef struct znet_rtt_t
+{
+    uint32_t srtt8;   /**< Smoothed RTT * 8 (ms), 0 - no samples */
+    uint32_t rttvar4; /**< RTT variation * 4 (ms) */
+    uint32_t rto;     /**< Timeout without backoff (ms) */
+    uint8_t backoff;  /**< Losses in a row */
+    uint32_t samples; /**< Number of samples */
+} znet_rtt_t;
+
+/**
+ * @brief Init statistics of all nodes
+ */
+void znet_rtt_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Add sample: time from transmit to report
+ *
+ * Resets the backoff.
+ */
+void znet_rtt_sample( znet_ctx_t* ctx, znet_node_id_t node_id, uint32_t rtt_ms );
+
+/**
+ * @brief Report was not received in time, back off
+ */
+void znet_rtt_loss( znet_ctx_t* ctx, znet_node_id_t node_id );
+
+/**
+ * @brief Get current timeout of node with backoff applied (ms)
+ */
+uint32_t znet_rtt_timeout( znet_ctx_t* ctx, znet_node_id_t node_id );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_RTT_H
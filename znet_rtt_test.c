@@ -0,0 +1,93 @@
+/**
+ * @file znet_rtt_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of round-trip time and timeouts of nodes.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_rtt_test.c -o znet_rtt_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_rtt.c"
+
+#define TEST_NODE 5
+
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    znet_rtt_init( &_test_ctx );
+    return &_test_ctx;
+}
+
+/// INFO: the timeout follows the samples, SRTT + 4 * RTTVAR
+static void _test_estimate( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    assert( znet_rtt_timeout( ctx, TEST_NODE ) == ZNET_RTT_INITIAL_MS );
+
+    znet_rtt_sample( ctx, TEST_NODE, 100 );
+    assert( znet_rtt_timeout( ctx, TEST_NODE ) == 300 );
+
+    /// INFO: a steady RTT narrows the variation
+    for( int i = 0; i < 50; i++ )
+        znet_rtt_sample( ctx, TEST_NODE, 400 );
+    znet_node_rtt_t stats;
+    assert( !znet_ctx_node_rtt( ctx, TEST_NODE, &stats ) );
+    assert( stats.srtt >= 395 && stats.srtt <= 400 );
+    assert( stats.rttvar <= 5 && stats.samples == 51 );
+    assert( stats.timeout >= 400 && stats.timeout <= 420 );
+}
+
+/// INFO: losses double the timeout up to the backoff limit, a sample resets it
+static void _test_backoff( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_rtt_sample( ctx, TEST_NODE, 100 );
+
+    for( int i = 0; i < ZNET_RTT_BACKOFF_MAX + 2; i++ )
+        znet_rtt_loss( ctx, TEST_NODE );
+    assert( znet_rtt_timeout( ctx, TEST_NODE ) ==
+            300u << ZNET_RTT_BACKOFF_MAX );
+
+    znet_rtt_sample( ctx, TEST_NODE, 100 );
+    assert( znet_rtt_timeout( ctx, TEST_NODE ) < 300 );
+
+    /// INFO: the backoff never goes over the max timeout
+    znet_rtt_sample( ctx, TEST_NODE, 10000 );
+    znet_rtt_loss( ctx, TEST_NODE );
+    znet_rtt_loss( ctx, TEST_NODE );
+    assert( znet_rtt_timeout( ctx, TEST_NODE ) == ZNET_RTT_MAX_MS );
+}
+
+/// INFO: the timeout stays within its bounds, unknown nodes get the default
+static void _test_bounds( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_rtt_sample( ctx, TEST_NODE, 0 );
+    assert( znet_rtt_timeout( ctx, TEST_NODE ) == ZNET_RTT_MIN_MS );
+
+    znet_rtt_sample( ctx, TEST_NODE + 1, 20000 );
+    assert( znet_rtt_timeout( ctx, TEST_NODE + 1 ) == ZNET_RTT_MAX_MS );
+
+    znet_rtt_sample( ctx, ZNET_NODE_ID_INVALID, 100 );
+    assert( znet_rtt_timeout( ctx, ZNET_NODE_ID_INVALID ) == ZNET_RTT_INITIAL_MS );
+
+    znet_node_rtt_t stats;
+    assert( znet_ctx_node_rtt( ctx, ZNET_NODE_ID_INVALID, &stats ) == -1 );
+}
+
+int main( void )
+{
+    _test_estimate();
+    _test_backoff();
+    _test_bounds();
+    printf( "znet_rtt_test: OK\n" );
+    return 0;
+}
@@ -0,0 +1,233 @@
+/**
+ * @file znet_state.c
+ * @date 18 Oct 2026
+ * @brief Last known values of nodes, readable from any thread.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_state.h"
+
+#define ZNET_STATE_MASK ( ZNET_STATE_MAX - 1 )
+
+/// INFO: removed value, lookups go on past it
+#define ZNET_STATE_KEY_REMOVED UINT64_MAX
+
+_Static_assert( ZNET_STATE_MAX && !( ZNET_STATE_MAX & ZNET_STATE_MASK ),
+                "ZNET_CFG_STATE_MAX must be a power of 2" );
+
+static uint64_t _znet_state_key( znet_node_id_t node_id,
+                                 znet_node_channel_id_t channel_id,
+                                 znet_command_class_t command, uint16_t index )
+{
+    return ( (uint64_t)node_id << 32 ) | ( (uint64_t)channel_id << 24 ) |
+           ( (uint64_t)command << 16 ) | index;
+}
+
+static size_t _znet_state_hash( uint64_t key )
+{
+    /// INFO: Fibonacci hashing
+    return (size_t)( ( key * 0x9E3779B97F4A7C15ull ) >> 32 ) & ZNET_STATE_MASK;
+}
+
+static znet_state_slot_t* _znet_state_find( znet_state_table_t* table,
+                                            uint64_t key )
+{
+    size_t pos = _znet_state_hash( key );
+    for( size_t i = 0; i < ZNET_STATE_MAX; i++ )
+    {
+        znet_state_slot_t* slot = &table->slots[( pos + i ) & ZNET_STATE_MASK];
+        uint64_t slot_key = atomic_load_explicit( &slot->key, memory_order_acquire );
+        if( slot_key == key )
+            return slot;
+        if( slot_key == 0 )
+            return NULL;
+    }
+    return NULL;
+}
+
+/// INFO: the first removed or free slot of the probe sequence, the value
+/// updated longest ago when the table is full; every slot lies on the probe
+/// sequence of the key then
+static znet_state_slot_t* _znet_state_claim( znet_state_table_t* table,
+                                             uint64_t key )
+{
+    znet_state_slot_t* oldest = NULL;
+    size_t pos = _znet_state_hash( key );
+    for( size_t i = 0; i < ZNET_STATE_MAX; i++ )
+    {
+        znet_state_slot_t* slot = &table->slots[( pos + i ) & ZNET_STATE_MASK];
+        uint64_t slot_key = atomic_load_explicit( &slot->key, memory_order_relaxed );
+        if( slot_key == 0 || slot_key == ZNET_STATE_KEY_REMOVED )
+        {
+            atomic_fetch_add_explicit( &table->count, 1, memory_order_relaxed );
+            return slot;
+        }
+        if( !oldest || atomic_load_explicit( &slot->time, memory_order_relaxed ) <
+                           atomic_load_explicit( &oldest->time, memory_order_relaxed ) )
+            oldest = slot;
+    }
+
+    ZNET_LOGD( "ZNET: State table is full, oldest value is replaced\n" );
+    return oldest;
+}
+
+/// INFO: single writer, plain increment is enough
+static uint32_t _znet_state_write_begin( znet_state_slot_t* slot )
+{
+    uint32_t seq = atomic_load_explicit( &slot->seq, memory_order_relaxed );
+    atomic_store_explicit( &slot->seq, seq + 1, memory_order_relaxed );
+    atomic_thread_fence( memory_order_release );
+    return seq;
+}
+
+static void _znet_state_write_end( znet_state_slot_t* slot, uint32_t seq )
+{
+    atomic_store_explicit( &slot->seq, seq + 2, memory_order_release );
+}
+
+static int _znet_state_read( znet_state_slot_t* slot, uint64_t key,
+                             znet_state_t* state )
+{
+    uint32_t seq;
+    uint64_t slot_key = 0;
+    do
+    {
+        seq = atomic_load_explicit( &slot->seq, memory_order_acquire );
+        if( seq & 1 )
+            continue;
+
+        slot_key = atomic_load_explicit( &slot->key, memory_order_relaxed );
+        state->value = atomic_load_explicit( &slot->value, memory_order_relaxed );
+        state->meta = atomic_load_explicit( &slot->meta, memory_order_relaxed );
+        state->version = atomic_load_explicit( &slot->version, memory_order_relaxed );
+        state->time = atomic_load_explicit( &slot->time, memory_order_relaxed );
+
+        atomic_thread_fence( memory_order_acquire );
+    } while( ( seq & 1 ) ||
+             seq != atomic_load_explicit( &slot->seq, memory_order_relaxed ) );
+
+    /// INFO: the slot went to another value after it was found
+    if( slot_key != key )
+        return -1;
+
+    state->node_id = (znet_node_id_t)( key >> 32 );
+    state->channel_id = (znet_node_channel_id_t)( key >> 24 );
+    state->command = (znet_command_class_t)( key >> 16 );
+    state->index = (uint16_t)key;
+    return 0;
+}
+
+void znet_state_init( znet_ctx_t* ctx )
+{
+    znet_state_table_t* table = &ctx->state;
+
+    for( size_t i = 0; i < ZNET_STATE_MAX; i++ )
+    {
+        atomic_init( &table->slots[i].key, 0 );
+        atomic_init( &table->slots[i].seq, 0 );
+        atomic_init( &table->slots[i].value, 0 );
+        atomic_init( &table->slots[i].meta, 0 );
+        atomic_init( &table->slots[i].version, 0 );
+        atomic_init( &table->slots[i].time, 0 );
+    }
+    atomic_init( &table->count, 0 );
+}
+
+void znet_state_update( znet_ctx_t* ctx, znet_node_id_t node_id,
+                        znet_node_channel_id_t channel_id,
+                        znet_command_class_t command, uint16_t index,
+                        int32_t value, uint16_t meta )
+{
+    if( node_id < ZNET_NODE_ID_MIN || node_id > ZNET_NODE_ID_MAX )
+        return;
+
+    uint64_t key = _znet_state_key( node_id, channel_id, command, index );
+    znet_state_slot_t* slot = _znet_state_find( &ctx->state, key );
+    int fresh = !slot;
+    if( fresh )
+        slot = _znet_state_claim( &ctx->state, key );
+
+    uint64_t now = ctx->cb->clock( ctx->cb->arg );
+    uint32_t seq = _znet_state_write_begin( slot );
+
+    uint32_t version = 0;
+    if( fresh )
+        atomic_store_explicit( &slot->key, key, memory_order_relaxed );
+    else
+        version = atomic_load_explicit( &slot->version, memory_order_relaxed );
+    atomic_store_explicit( &slot->value, value, memory_order_relaxed );
+    atomic_store_explicit( &slot->meta, meta, memory_order_relaxed );
+    atomic_store_explicit( &slot->time, now, memory_order_relaxed );
+    atomic_store_explicit( &slot->version, version + 1, memory_order_relaxed );
+
+    _znet_state_write_end( slot, seq );
+}
+
+int znet_ctx_state_read( znet_ctx_t* ctx, znet_node_id_t node_id,
+                         znet_node_channel_id_t channel_id,
+                         znet_command_class_t command, uint16_t index,
+                         znet_state_t* state )
+{
+    if( !ctx || !state )
+        return -1;
+
+    uint64_t key = _znet_state_key( node_id, channel_id, command, index );
+    znet_state_slot_t* slot = _znet_state_find( &ctx->state, key );
+    if( !slot )
+        return -1;
+
+    return _znet_state_read( slot, key, state );
+}
+
+size_t znet_ctx_state_node( znet_ctx_t* ctx, znet_node_id_t node_id,
+                            znet_state_t* states, size_t max )
+{
+    if( !ctx || !states )
+        return 0;
+
+    size_t count = 0;
+    for( size_t i = 0; i < ZNET_STATE_MAX && count < max; i++ )
+    {
+        znet_state_slot_t* slot = &ctx->state.slots[i];
+        uint64_t key = atomic_load_explicit( &slot->key, memory_order_acquire );
+        if( key && key != ZNET_STATE_KEY_REMOVED &&
+            (znet_node_id_t)( key >> 32 ) == node_id &&
+            !_znet_state_read( slot, key, &states[count] ) )
+            count++;
+    }
+    return count;
+}
+
+size_t znet_ctx_state_clear( znet_ctx_t* ctx, znet_node_id_t node_id )
+{
+    if( !ctx )
+        return 0;
+
+    znet_state_table_t* table = &ctx->state;
+    size_t count = 0;
+    for( size_t i = 0; i < ZNET_STATE_MAX; i++ )
+    {
+        znet_state_slot_t* slot = &table->slots[i];
+        uint64_t key = atomic_load_explicit( &slot->key, memory_order_relaxed );
+        if( !key || key == ZNET_STATE_KEY_REMOVED ||
+            (znet_node_id_t)( key >> 32 ) != node_id )
+            continue;
+
+        uint32_t seq = _znet_state_write_begin( slot );
+        atomic_store_explicit( &slot->key, ZNET_STATE_KEY_REMOVED,
+                               memory_order_relaxed );
+        _znet_state_write_end( slot, seq );
+        atomic_fetch_sub_explicit( &table->count, 1, memory_order_relaxed );
+        count++;
+    }
+    return count;
+}
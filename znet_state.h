@@ -0,0 +1,76 @@
+/**
+ * @file znet_state.h
+ * @date 18 Oct 2026
+ * @brief Last known values of nodes, readable from any thread.
+ */
+
+#ifndef ZNET_STATE_H
+#define ZNET_STATE_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of values (power of 2), see ZNET_CFG_STATE_MAX
+ */
+#define ZNET_STATE_MAX ZNET_CFG_STATE_MAX
+
+/**
+ * @brief Value slot guarded by a sequence counter
+ *
+ * Written by the thread of znet_proc only. The counter is odd while the slot
+ * is written, readers retry until they see the same even counter before and
+ * after the copy. The key is part of the copy: a slot may be given to another
+ * value meanwhile.
+ */
+typedef struct znet_state_slot_t
+{
+    atomic_uint_least64_t key;     /**< Packed key, 0 - free slot */
+    atomic_uint_least32_t seq;     /**< Sequence counter */
+    atomic_int_least32_t value;    /**< Value */
+    atomic_uint_least16_t meta;    /**< Command class specific: size, scale */
+    atomic_uint_least32_t version; /**< Number of updates */
+    atomic_uint_least64_t time;    /**< Time of update (ms) */
+} znet_state_slot_t;
+
+/**
+ * @brief Values of the context
+ */
+typedef struct znet_state_table_t
+{
+    znet_state_slot_t slots[ZNET_STATE_MAX]; /**< Open addressing table */
+    atomic_uint_least32_t count;             /**< Values in the table */
+} znet_state_table_t;
+
+/**
+ * @brief Init empty table
+ */
+void znet_state_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Store reported value
+ *
+ * A new value takes the slot of the value updated longest ago when the table
+ * is full.
+ *
+ * @param command Command class
+ * @param index Command class specific: parameter number, meter scale, 0
+ * @param value Value
+ * @param meta Command class specific: size of value, precision
+ */
+void znet_state_update( znet_ctx_t* ctx, znet_node_id_t node_id,
+                        znet_node_channel_id_t channel_id,
+                        znet_command_class_t command, uint16_t index,
+                        int32_t value, uint16_t meta );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_STATE_H
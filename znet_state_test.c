@@ -0,0 +1,166 @@
+/**
+ * @file znet_state_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of last known values of nodes.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_state_test.c -o znet_state_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+/// INFO: module under test
+#include "znet_state.c"
+
+#define TEST_NODE 5
+#define TEST_OTHER_NODE 6
+#define TEST_CC 0x70
+#define TEST_UPDATES 200000
+
+static struct
+{
+    atomic_uint_least64_t now;
+    atomic_int done;  /**< flag: writer finished */
+    size_t reads;     /**< Values seen by the reader */
+} test;
+
+static uint64_t _test_clock( void* arg )
+{
+    (void)arg;
+    return atomic_load_explicit( &test.now, memory_order_relaxed );
+}
+
+static const znet_callbacks_t _test_cb = { .clock = _test_clock };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    atomic_init( &test.now, 1000 );
+    atomic_init( &test.done, 0 );
+    test.reads = 0;
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_state_init( &_test_ctx );
+    return &_test_ctx;
+}
+
+static void _test_update( znet_ctx_t* ctx, znet_node_id_t node_id,
+                          uint16_t index, int32_t value )
+{
+    atomic_fetch_add_explicit( &test.now, 1, memory_order_relaxed );
+    znet_state_update( ctx, node_id, ZNET_CHANNEL_ID_ROOT, TEST_CC, index,
+                       value, (uint16_t)value );
+}
+
+static int _test_read( znet_ctx_t* ctx, znet_node_id_t node_id,
+                       uint16_t index, znet_state_t* state )
+{
+    return znet_ctx_state_read( ctx, node_id, ZNET_CHANNEL_ID_ROOT, TEST_CC,
+                                index, state );
+}
+
+/// INFO: the values of a cleared node are gone, their slots are used again
+static void _test_clear( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_state_t state;
+    for( uint16_t i = 1; i <= 10; i++ )
+    {
+        _test_update( ctx, TEST_NODE, i, i );
+        _test_update( ctx, TEST_OTHER_NODE, i, -i );
+    }
+    _test_update( ctx, TEST_NODE, 1, 100 );
+    assert( !_test_read( ctx, TEST_NODE, 1, &state ) );
+    assert( state.value == 100 && state.version == 2 );
+
+    assert( znet_ctx_state_clear( ctx, TEST_NODE ) == 10 );
+    assert( _test_read( ctx, TEST_NODE, 1, &state ) == -1 );
+    assert( znet_ctx_state_node( ctx, TEST_NODE, &state, 1 ) == 0 );
+    assert( atomic_load( &ctx->state.count ) == 10 );
+
+    /// INFO: the values of other nodes are found past the removed ones
+    for( uint16_t i = 1; i <= 10; i++ )
+    {
+        assert( !_test_read( ctx, TEST_OTHER_NODE, i, &state ) );
+        assert( state.value == -i );
+    }
+
+    _test_update( ctx, TEST_NODE, 1, 7 );
+    assert( !_test_read( ctx, TEST_NODE, 1, &state ) );
+    assert( state.value == 7 && state.version == 1 );
+    assert( atomic_load( &ctx->state.count ) == 11 );
+}
+
+/// INFO: a full table gives the slot of the oldest value to the new one
+static void _test_evict( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_state_t state;
+    for( uint16_t i = 0; i < ZNET_STATE_MAX; i++ )
+        _test_update( ctx, TEST_NODE, i, i );
+    _test_update( ctx, TEST_NODE, 0, 1000 );
+
+    _test_update( ctx, TEST_OTHER_NODE, 1, 1 );
+    assert( !_test_read( ctx, TEST_OTHER_NODE, 1, &state ) );
+    assert( _test_read( ctx, TEST_NODE, 1, &state ) == -1 );
+    for( uint16_t i = 2; i < ZNET_STATE_MAX; i++ )
+        assert( !_test_read( ctx, TEST_NODE, i, &state ) && state.value == i );
+    assert( !_test_read( ctx, TEST_NODE, 0, &state ) && state.value == 1000 );
+    assert( atomic_load( &ctx->state.count ) == ZNET_STATE_MAX );
+}
+
+#ifndef __STDC_NO_THREADS__
+/// INFO: every snapshot is consistent: meta and time follow the value
+static int _test_reader( void* arg )
+{
+    znet_ctx_t* ctx = arg;
+    while( !atomic_load_explicit( &test.done, memory_order_acquire ) )
+    {
+        znet_state_t state;
+        if( _test_read( ctx, TEST_NODE, 1, &state ) )
+            continue;
+        assert( state.node_id == TEST_NODE && state.index == 1 );
+        assert( state.meta == (uint16_t)state.value );
+        assert( state.time == 1000 + 2 * (uint64_t)state.value - 1 );
+        test.reads++;
+    }
+    return 0;
+}
+
+/// INFO: the value is updated, removed and stored again while it is read
+static void _test_seqlock( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    thrd_t reader;
+    assert( thrd_create( &reader, _test_reader, ctx ) == thrd_success );
+
+    for( int32_t i = 1; i <= TEST_UPDATES; i++ )
+    {
+        atomic_store_explicit( &test.now, 1000 + 2 * (uint64_t)i - 1,
+                               memory_order_relaxed );
+        znet_state_update( ctx, TEST_NODE, ZNET_CHANNEL_ID_ROOT, TEST_CC, 1, i,
+                           (uint16_t)i );
+        if( !( i % 64 ) )
+            znet_ctx_state_clear( ctx, TEST_NODE );
+    }
+    atomic_store_explicit( &test.done, 1, memory_order_release );
+    assert( thrd_join( reader, NULL ) == thrd_success );
+}
+#endif
+
+int main( void )
+{
+    _test_clear();
+    _test_evict();
+#ifndef __STDC_NO_THREADS__
+    _test_seqlock();
+#endif
+    printf( "znet_state_test: OK\n" );
+    return 0;
+}
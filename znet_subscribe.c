@@ -0,0 +1,198 @@
+/**
+ * @file znet_subscribe.c
+ * @date 18 Oct 2026
+ * @brief Filtered subscriptions to reports.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_dispatch.h"
+#include "znet_subscribe.h"
+
+/// INFO: internal
+#include <znet_lib.h>
+#include <znet_lib_cc_application.h>
+
+/// INFO: command class and command of report delivered by event
+static const struct
+{
+    znet_command_class_t command_class;
+    uint8_t command;
+} _znet_subscribe_events[ZNET_EVENT_COUNT] = {
+#if ZNET_CFG_CC_CONFIGURATION
+    [ZNET_EVENT_CONFIGURATION] = { ZNET_COMMAND_CLASS_CONFIGURATION,
+                                   CONFIGURATION_REPORT },
+    [ZNET_EVENT_CONFIGURATION_BULK] = { ZNET_COMMAND_CLASS_CONFIGURATION,
+                                        CONFIGURATION_BULK_REPORT_V4 },
+    /// INFO: results of Sets come with the command of the Set
+    [ZNET_EVENT_CONFIGURATION_SET] = { ZNET_COMMAND_CLASS_CONFIGURATION,
+                                       CONFIGURATION_SET },
+    [ZNET_EVENT_CONFIGURATION_BULK_SET] = { ZNET_COMMAND_CLASS_CONFIGURATION,
+                                            CONFIGURATION_BULK_SET_V4 },
+    [ZNET_EVENT_CONFIGURATION_NAME] = { ZNET_COMMAND_CLASS_CONFIGURATION,
+                                        CONFIGURATION_NAME_REPORT_V4 },
+    [ZNET_EVENT_CONFIGURATION_INFO] = { ZNET_COMMAND_CLASS_CONFIGURATION,
+                                        CONFIGURATION_INFO_REPORT_V4 },
+    [ZNET_EVENT_CONFIGURATION_PROPERTIES] = { ZNET_COMMAND_CLASS_CONFIGURATION,
+                                              CONFIGURATION_PROPERTIES_REPORT_V4 },
+    /// INFO: decoded copy and results of discovery and backup, no command of
+    /// its own
+    [ZNET_EVENT_CONFIGURATION_BULK_VALUES] = { ZNET_COMMAND_CLASS_CONFIGURATION, 0 },
+    [ZNET_EVENT_CONFIGURATION_WALK] = { ZNET_COMMAND_CLASS_CONFIGURATION, 0 },
+    [ZNET_EVENT_CONFIGURATION_BACKUP] = { ZNET_COMMAND_CLASS_CONFIGURATION, 0 },
+    [ZNET_EVENT_CONFIGURATION_RESTORE] = { ZNET_COMMAND_CLASS_CONFIGURATION, 0 },
+#endif
+    /// INFO: health and interview are no reports, only their callbacks get them
+};
+
+static int _znet_subscribe_match_event( const znet_report_filter_t* filter,
+                                        size_t type )
+{
+    if( _znet_subscribe_events[type].command_class == 0 )
+        return 0;
+    if( filter->command_class &&
+        filter->command_class != _znet_subscribe_events[type].command_class )
+        return 0;
+    if( filter->command && filter->command != _znet_subscribe_events[type].command )
+        return 0;
+    return 1;
+}
+
+/// INFO: handle is never 0 and never reused soon; after the wrap a handle in
+/// use is skipped
+static int _znet_subscribe_handle( znet_subscribe_t* subscribe )
+{
+    for( ;; )
+    {
+        if( subscribe->last_handle == INT_MAX )
+            subscribe->last_handle = 0;
+        int handle = ++subscribe->last_handle;
+
+        size_t i = 0;
+        while( i < ZNET_SUBSCRIBE_MAX && subscribe->subs[i].handle != handle )
+            i++;
+        if( i == ZNET_SUBSCRIBE_MAX )
+            return handle;
+    }
+}
+
+void znet_subscribe_init( znet_ctx_t* ctx )
+{
+    memset( &ctx->subscribe, 0, sizeof( znet_subscribe_t ) );
+}
+
+int znet_subscribe_any( znet_ctx_t* ctx, znet_event_type_t type )
+{
+    return type < ZNET_EVENT_COUNT && ctx->subscribe.count[type] != 0;
+}
+
+void znet_subscribe_notify( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                            znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            const void* value, size_t size )
+{
+    znet_subscribe_t* subscribe = &ctx->subscribe;
+    if( type >= ZNET_EVENT_COUNT || !subscribe->count[type] )
+        return;
+
+    znet_report_t report = {
+        .err = err,
+        .node_id = node_id,
+        .channel_id = channel_id,
+        .command_class = _znet_subscribe_events[type].command_class,
+        .command = _znet_subscribe_events[type].command,
+        .value = value,
+        .size = value ? size : 0 };
+
+    /// INFO: handlers may unsubscribe, walk a copy of the list
+    uint8_t list[ZNET_SUBSCRIBE_MAX];
+    uint8_t count = subscribe->count[type];
+    memcpy( list, subscribe->lists[type], count );
+
+    for( uint8_t i = 0; i < count; i++ )
+    {
+        const znet_subscription_t* sub = &subscribe->subs[list[i]];
+        const znet_report_filter_t* filter = &sub->filter;
+
+        if( !sub->handle )
+            continue;
+
+        if( filter->channel_id != ZNET_REPORT_ANY_CHANNEL &&
+            filter->channel_id != channel_id )
+            continue;
+        if( !sub->any_node && ( node_id > ZNET_NODE_ID_MAX ||
+                                !ZNET_REPORT_FILTER_HAS_NODE( filter, node_id ) ) )
+            continue;
+
+        sub->handler( &report, sub->arg );
+    }
+}
+
+int znet_ctx_subscribe( znet_ctx_t* ctx, const znet_report_filter_t* filter,
+                        ZNET_REPORT_HANDLER handler, void* arg )
+{
+    if( !ctx || !filter || !handler )
+        return -1;
+
+    znet_subscribe_t* subscribe = &ctx->subscribe;
+    size_t index = 0;
+    while( index < ZNET_SUBSCRIBE_MAX && subscribe->subs[index].handle )
+        index++;
+    if( index == ZNET_SUBSCRIBE_MAX )
+    {
+        ZNET_LOGE( "ZNET: No room for subscription!\n" );
+        return -1;
+    }
+
+    znet_subscription_t* sub = &subscribe->subs[index];
+    sub->handle = _znet_subscribe_handle( subscribe );
+    sub->filter = *filter;
+    sub->handler = handler;
+    sub->arg = arg;
+    sub->any_node = 1;
+    for( size_t i = 0; i < sizeof( filter->nodes ); i++ )
+        if( filter->nodes[i] )
+            sub->any_node = 0;
+
+    for( size_t type = 0; type < ZNET_EVENT_COUNT; type++ )
+        if( _znet_subscribe_match_event( filter, type ) )
+            subscribe->lists[type][subscribe->count[type]++] = (uint8_t)index;
+
+    return sub->handle;
+}
+
+int znet_ctx_unsubscribe( znet_ctx_t* ctx, int handle )
+{
+    if( !ctx || handle <= 0 )
+        return -1;
+
+    znet_subscribe_t* subscribe = &ctx->subscribe;
+    size_t index = 0;
+    while( index < ZNET_SUBSCRIBE_MAX && subscribe->subs[index].handle != handle )
+        index++;
+    if( index == ZNET_SUBSCRIBE_MAX )
+        return -1;
+
+    /// INFO: keep the order of the other subscriptions
+    for( size_t type = 0; type < ZNET_EVENT_COUNT; type++ )
+    {
+        uint8_t* list = subscribe->lists[type];
+        uint8_t count = 0;
+        for( uint8_t i = 0; i < subscribe->count[type]; i++ )
+            if( list[i] != index )
+                list[count++] = list[i];
+        subscribe->count[type] = count;
+    }
+
+    memset( &subscribe->subs[index], 0, sizeof( znet_subscription_t ) );
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file znet_subscribe.h
+ * @date 18 Oct 2026
+ * @brief Filtered subscriptions to reports.
+ */
+
+#ifndef ZNET_SUBSCRIBE_H
+#define ZNET_SUBSCRIBE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#include "znet_dispatch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Max number of subscriptions of the context
+ */
+#define ZNET_SUBSCRIBE_MAX 32
+
+/**
+ * @brief Subscription
+ */
+typedef struct znet_subscription_t
+{
+    int handle;                    /**< Handle, 0 - free slot */
+    znet_report_filter_t filter;   /**< Filter */
+    uint8_t any_node;              /**< flag: node set of filter is empty */
+    ZNET_REPORT_HANDLER handler;   /**< Handler */
+    void* arg;                     /**< Parameter of handler */
+} znet_subscription_t;
+
+/**
+ * @brief Subscriptions of the context
+ *
+ * Every event type has the list of subscriptions matching its command class
+ * and command, so a report visits matching subscriptions only.
+ */
+typedef struct znet_subscribe_t
+{
+    int last_handle;                                    /**< Last handle */
+    znet_subscription_t subs[ZNET_SUBSCRIBE_MAX];       /**< Subscriptions */
+    uint8_t count[ZNET_EVENT_COUNT];                    /**< List sizes */
+    uint8_t lists[ZNET_EVENT_COUNT][ZNET_SUBSCRIBE_MAX]; /**< Indexes of subs */
+} znet_subscribe_t;
+
+/**
+ * @brief Init without subscriptions
+ */
+void znet_subscribe_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Check that event type has subscriptions
+ */
+int znet_subscribe_any( znet_ctx_t* ctx, znet_event_type_t type );
+
+/**
+ * @brief Run handlers of subscriptions matching the report
+ */
+void znet_subscribe_notify( znet_ctx_t* ctx, znet_event_type_t type, int err,
+                            znet_node_id_t node_id,
+                            znet_node_channel_id_t channel_id,
+                            const void* value, size_t size );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_SUBSCRIBE_H
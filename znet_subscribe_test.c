@@ -0,0 +1,130 @@
+/**
+ * @file znet_subscribe_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of filtered subscriptions to reports.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_subscribe_test.c -o znet_subscribe_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_subscribe.c"
+
+#if ZNET_CFG_CC_CONFIGURATION
+
+#define TEST_NODE 5
+#define TEST_OTHER_NODE 6
+#define TEST_CHANNEL 2
+
+static struct
+{
+    size_t calls[2];  /**< Calls of handler by its arg */
+    uint8_t command;  /**< Command of last report */
+    int unsubscribe;  /**< Handle the handler removes, 0 - none */
+} test;
+
+static znet_ctx_t _test_ctx;
+
+static void _test_handler( const znet_report_t* report, void* arg )
+{
+    test.calls[(size_t)arg]++;
+    test.command = report->command;
+    if( test.unsubscribe )
+        assert( !znet_ctx_unsubscribe( &_test_ctx, test.unsubscribe ) );
+}
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    znet_subscribe_init( &_test_ctx );
+    return &_test_ctx;
+}
+
+static void _test_notify( znet_ctx_t* ctx, znet_event_type_t type,
+                          znet_node_id_t node_id,
+                          znet_node_channel_id_t channel_id )
+{
+    znet_configuration_report_t report = { .param_number = 1 };
+    znet_subscribe_notify( ctx, type, 0, node_id, channel_id, &report,
+                           sizeof( report ) );
+}
+
+/// INFO: reports reach the subscriptions of their node, channel and command
+static void _test_filter( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_report_filter_t filter = { .channel_id = TEST_CHANNEL,
+                                    .command_class =
+                                        ZNET_COMMAND_CLASS_CONFIGURATION,
+                                    .command = CONFIGURATION_REPORT };
+    ZNET_REPORT_FILTER_ADD_NODE( &filter, TEST_NODE );
+    assert( znet_ctx_subscribe( ctx, &filter, _test_handler, (void*)0 ) > 0 );
+
+    znet_report_filter_t any = { .channel_id = ZNET_REPORT_ANY_CHANNEL };
+    assert( znet_ctx_subscribe( ctx, &any, _test_handler, (void*)1 ) > 0 );
+    assert( znet_subscribe_any( ctx, ZNET_EVENT_CONFIGURATION_SET ) );
+
+    _test_notify( ctx, ZNET_EVENT_CONFIGURATION, TEST_NODE, TEST_CHANNEL );
+    _test_notify( ctx, ZNET_EVENT_CONFIGURATION, TEST_OTHER_NODE, TEST_CHANNEL );
+    _test_notify( ctx, ZNET_EVENT_CONFIGURATION, TEST_NODE, ZNET_CHANNEL_ID_ROOT );
+    _test_notify( ctx, ZNET_EVENT_CONFIGURATION, ZNET_NODE_ID_INVALID,
+                  TEST_CHANNEL );
+    assert( test.calls[0] == 1 && test.calls[1] == 4 );
+
+    /// INFO: a Set result is no Configuration Report
+    _test_notify( ctx, ZNET_EVENT_CONFIGURATION_SET, TEST_NODE, TEST_CHANNEL );
+    assert( test.calls[0] == 1 && test.calls[1] == 5 );
+    assert( test.command == CONFIGURATION_SET );
+}
+
+/// INFO: a handler may remove a subscription the report did not visit yet
+static void _test_unsubscribe( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_report_filter_t any = { .channel_id = ZNET_REPORT_ANY_CHANNEL };
+    assert( znet_ctx_subscribe( ctx, &any, _test_handler, (void*)0 ) > 0 );
+    int second = znet_ctx_subscribe( ctx, &any, _test_handler, (void*)1 );
+
+    test.unsubscribe = second;
+    _test_notify( ctx, ZNET_EVENT_CONFIGURATION, TEST_NODE, TEST_CHANNEL );
+    assert( test.calls[0] == 1 && test.calls[1] == 0 );
+    assert( znet_ctx_unsubscribe( ctx, second ) == -1 );
+}
+
+/// INFO: handles stay positive after the wrap and skip the ones in use
+static void _test_handle_wrap( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    znet_report_filter_t any = { .channel_id = ZNET_REPORT_ANY_CHANNEL };
+    int first = znet_ctx_subscribe( ctx, &any, _test_handler, (void*)0 );
+    assert( first == 1 );
+
+    ctx->subscribe.last_handle = INT_MAX - 1;
+    assert( znet_ctx_subscribe( ctx, &any, _test_handler, (void*)0 ) == INT_MAX );
+    assert( znet_ctx_subscribe( ctx, &any, _test_handler, (void*)0 ) == 2 );
+    assert( !znet_ctx_unsubscribe( ctx, INT_MAX ) );
+}
+
+int main( void )
+{
+    _test_filter();
+    _test_unsubscribe();
+    _test_handle_wrap();
+    printf( "znet_subscribe_test: OK\n" );
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    return 0;
+}
+
+#endif  // ZNET_CFG_CC_CONFIGURATION
@@ -0,0 +1,181 @@
+/**
+ * @file znet_uart.c
+ * @date 18 Oct 2026
+ * @brief Transmit path to the zwave module.
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <string.h>
+
+/// INFO: public
+#include <znet/znet.h>
+
+/// INFO: private
+#include "znet_ctx.h"
+#include "znet_log.h"
+#include "znet_uart.h"
+
+#define ZNET_UART_TX_MASK ( ZNET_UART_TX_RING - 1 )
+
+static int _znet_uart_free_space( znet_ctx_t* ctx, size_t* free_size )
+{
+    const znet_callbacks_t* cb = ctx->cb;
+
+    *free_size = 0;
+    if( cb->uart_write( NULL, 0, free_size, cb->arg ) )
+        return -1;
+    return 0;
+}
+
+/// INFO: put is the number of bytes uart accepted
+static int _znet_uart_put( znet_ctx_t* ctx, const uint8_t* data, size_t size,
+                           size_t* put )
+{
+    const znet_callbacks_t* cb = ctx->cb;
+
+    size_t ret_size = 0;
+    if( cb->uart_write( data, size, &ret_size, cb->arg ) )
+        return -1;
+
+    if( ret_size > size )
+        ret_size = size;
+    ctx->uart.written += (uint32_t)ret_size;
+    if( put )
+        *put = ret_size;
+    return 0;
+}
+
+static size_t _znet_uart_ring_space( const znet_uart_t* uart )
+{
+    return ZNET_UART_TX_RING - ( uart->tail - uart->head );
+}
+
+void znet_uart_init( znet_ctx_t* ctx )
+{
+    znet_uart_t* uart = &ctx->uart;
+
+    uart->mode = ZNET_UART_MODE_BLOCKING;
+    uart->head = 0;
+    uart->tail = 0;
+}
+
+int znet_uart_flush( znet_ctx_t* ctx )
+{
+    znet_uart_t* uart = &ctx->uart;
+
+    while( uart->head != uart->tail )
+    {
+        size_t free_size;
+        if( _znet_uart_free_space( ctx, &free_size ) )
+            return -1;
+        if( !free_size )
+            return 0;
+
+        /// INFO: contiguous part up to the end of the ring
+        size_t pos = uart->head & ZNET_UART_TX_MASK;
+        size_t size = uart->tail - uart->head;
+        if( size > ZNET_UART_TX_RING - pos )
+            size = ZNET_UART_TX_RING - pos;
+        if( size > free_size )
+            size = free_size;
+
+        size_t put = 0;
+        if( _znet_uart_put( ctx, &uart->ring[pos], size, &put ) )
+            return -1;
+        uart->head += put;
+        if( !put )
+            return 0;
+    }
+    return 0;
+}
+
+int znet_uart_write( znet_ctx_t* ctx, const void* data, size_t size )
+{
+    znet_uart_t* uart = &ctx->uart;
+    const uint8_t* bytes = (const uint8_t*)data;
+
+    if( !size )
+        return 0;
+
+    if( uart->mode == ZNET_UART_MODE_BLOCKING )
+        return _znet_uart_put( ctx, bytes, size, NULL );
+
+    /// INFO: data queued before goes first
+    if( znet_uart_flush( ctx ) )
+        return -1;
+
+    size_t free_size = 0;
+    if( uart->head == uart->tail && _znet_uart_free_space( ctx, &free_size ) )
+        return -1;
+
+    /// INFO: the frame is taken whole or not at all, nothing partial goes out;
+    /// uart may accept less than its free space, so the ring must hold the
+    /// whole frame
+    if( size > _znet_uart_ring_space( uart ) )
+    {
+        uart->overflow++;
+        ZNET_LOGE( "ZNET: Uart tx ring overflow!\n" );
+        return -1;
+    }
+
+    size_t count = size < free_size ? size : free_size;
+    if( count )
+    {
+        size_t put = 0;
+        if( _znet_uart_put( ctx, bytes, count, &put ) )
+            return -1;
+        bytes += put;
+        size -= put;
+        if( !size )
+            return 0;
+    }
+
+    for( size_t i = 0; i < size; i++ )
+        uart->ring[( uart->tail + i ) & ZNET_UART_TX_MASK] = bytes[i];
+    uart->tail += size;
+    uart->deferred += size;
+
+    size_t used = uart->tail - uart->head;
+    if( used > uart->high_water )
+        uart->high_water = used;
+    return 0;
+}
+
+int znet_ctx_uart_mode( znet_ctx_t* ctx, int mode )
+{
+    if( !ctx )
+        return -1;
+
+    if( mode != ZNET_UART_MODE_BLOCKING && mode != ZNET_UART_MODE_NONBLOCKING )
+        return -1;
+
+    /// INFO: blocking writes must not overtake queued data
+    if( mode == ZNET_UART_MODE_BLOCKING && ctx->uart.head != ctx->uart.tail )
+        return -1;
+
+    ctx->uart.mode = mode;
+    return 0;
+}
+
+void znet_ctx_uart_writable( znet_ctx_t* ctx )
+{
+    if( !ctx )
+        return;
+
+    if( znet_uart_flush( ctx ) )
+        ZNET_LOGE( "ZNET: Uart write failed!\n" );
+}
+
+void znet_ctx_uart_stats( znet_ctx_t* ctx, znet_uart_stats_t* stats )
+{
+    if( !ctx || !stats )
+        return;
+
+    const znet_uart_t* uart = &ctx->uart;
+    stats->pending = (uint32_t)( uart->tail - uart->head );
+    stats->written = uart->written;
+    stats->deferred = uart->deferred;
+    stats->overflow = uart->overflow;
+    stats->high_water = uart->high_water;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file znet_uart.h
+ * @date 18 Oct 2026
+ * @brief Transmit path to the zwave module.
+ */
+
+#ifndef ZNET_UART_H
+#define ZNET_UART_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <znet/znet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Size of outbound ring (power of 2)
+ *
+ * Holds several frames of max size.
+ */
+#define ZNET_UART_TX_RING 2048
+
+/**
+ * @brief Transmit state of the context
+ */
+typedef struct znet_uart_t
+{
+    int mode;                        /**< ZNET_UART_MODE_* */
+    uint8_t ring[ZNET_UART_TX_RING]; /**< Data not accepted by uart yet */
+    size_t head;                     /**< Read position */
+    size_t tail;                     /**< Write position */
+
+    uint32_t written;    /**< Bytes accepted by uart */
+    uint32_t deferred;   /**< Bytes went through the ring */
+    uint32_t overflow;   /**< Writes failed due to full ring */
+    uint32_t high_water; /**< Max bytes in the ring */
+} znet_uart_t;
+
+/**
+ * @brief Init transmit state (blocking mode)
+ */
+void znet_uart_init( znet_ctx_t* ctx );
+
+/**
+ * @brief Write data to uart, used by the core instead of uart_write
+ *
+ * In blocking mode the data goes to uart_write as is. In non-blocking mode
+ * only data that fits into the uart tx buffer is written, the rest is kept in
+ * the ring in order. Data bigger than the free space of the ring is rejected
+ * before any byte is written.
+ *
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_uart_write( znet_ctx_t* ctx, const void* data, size_t size );
+
+/**
+ * @brief Write data kept in the ring as far as uart accepts it
+ *
+ * @return Return zero on success. On error, -1 is returned
+ */
+int znet_uart_flush( znet_ctx_t* ctx );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ZNET_UART_H
@@ -0,0 +1,179 @@
+/**
+ * @file znet_uart_test.c
+ * @date 18 Oct 2026
+ * @brief Unit tests of the non-blocking transmit ring.
+ *
+ * Build with the headers of the stack, e.g.:
+ * gcc -std=gnu11 -I. znet_uart_test.c -o znet_uart_test
+ */
+
+/// INFO: crt & system
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/// INFO: module under test
+#include "znet_uart.c"
+
+/// INFO: fake uart: accepts up to room bytes, keeps everything in order
+static struct
+{
+    size_t room;
+    size_t accept; /**< Max bytes taken by one write, 0 - room */
+    uint8_t out[4 * ZNET_UART_TX_RING];
+    size_t out_size;
+} test;
+
+static int _test_uart_write( const void* data, size_t size, size_t* ret_size,
+                             void* arg )
+{
+    (void)arg;
+    if( !data )
+    {
+        *ret_size = test.room;
+        return 0;
+    }
+
+    size_t n = size < test.room ? size : test.room;
+    if( test.accept && n > test.accept )
+        n = test.accept;
+    assert( test.out_size + n <= sizeof( test.out ) );
+    memcpy( &test.out[test.out_size], data, n );
+    test.out_size += n;
+    test.room -= n;
+    *ret_size = n;
+    return 0;
+}
+
+static const znet_callbacks_t _test_cb = { .uart_write = _test_uart_write };
+static znet_ctx_t _test_ctx;
+
+static znet_ctx_t* _test_setup( void )
+{
+    memset( &test, 0, sizeof( test ) );
+    memset( &_test_ctx, 0, sizeof( _test_ctx ) );
+    _test_ctx.cb = &_test_cb;
+    znet_uart_init( &_test_ctx );
+    assert( !znet_ctx_uart_mode( &_test_ctx, ZNET_UART_MODE_NONBLOCKING ) );
+    return &_test_ctx;
+}
+
+static void _test_frame( uint8_t* frame, size_t size, uint8_t seed )
+{
+    for( size_t i = 0; i < size; i++ )
+        frame[i] = (uint8_t)( seed + i );
+}
+
+/// INFO: frames queued across the end of the ring come out in order
+static void _test_wrap( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    uint8_t expected[4 * ZNET_UART_TX_RING];
+    size_t expected_size = 0;
+
+    /// INFO: move the positions near the end of the ring
+    uint8_t frame[ZNET_UART_TX_RING];
+    size_t size = ZNET_UART_TX_RING - 100;
+    _test_frame( frame, size, 1 );
+    assert( !znet_uart_write( ctx, frame, size ) );
+    memcpy( &expected[expected_size], frame, size );
+    expected_size += size;
+    test.room = ZNET_UART_TX_RING;
+    assert( !znet_uart_flush( ctx ) );
+    assert( ctx->uart.head == ctx->uart.tail );
+
+    /// INFO: 300 bytes, 100 to the end of the ring and 200 from its start
+    test.room = 0;
+    size = 300;
+    _test_frame( frame, size, 7 );
+    assert( !znet_uart_write( ctx, frame, size ) );
+    memcpy( &expected[expected_size], frame, size );
+    expected_size += size;
+    assert( ( ctx->uart.head & ZNET_UART_TX_MASK ) + size > ZNET_UART_TX_RING );
+
+    /// INFO: uart takes the queue in small parts
+    for( size_t i = 0; ctx->uart.head != ctx->uart.tail; i++ )
+    {
+        assert( i < 100 );
+        test.room = 64;
+        assert( !znet_uart_flush( ctx ) );
+    }
+
+    assert( test.out_size == expected_size );
+    assert( !memcmp( test.out, expected, expected_size ) );
+
+    znet_uart_stats_t stats;
+    znet_ctx_uart_stats( ctx, &stats );
+    assert( stats.pending == 0 && stats.written == expected_size );
+    assert( stats.overflow == 0 && stats.high_water == ZNET_UART_TX_RING - 100 );
+}
+
+/// INFO: a frame that does not fit is rejected before any byte goes out
+static void _test_overflow( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    uint8_t frame[ZNET_UART_TX_RING];
+    _test_frame( frame, sizeof( frame ), 3 );
+
+    test.room = 0;
+    assert( !znet_uart_write( ctx, frame, ZNET_UART_TX_RING - 10 ) );
+
+    /// INFO: queue is not empty, uart is not asked, 10 bytes of ring are left
+    test.room = 0;
+    assert( znet_uart_write( ctx, frame, 11 ) == -1 );
+    assert( test.out_size == 0 );
+    assert( ctx->uart.tail - ctx->uart.head == ZNET_UART_TX_RING - 10 );
+    assert( !znet_uart_write( ctx, frame, 10 ) );
+    assert( ctx->uart.tail - ctx->uart.head == ZNET_UART_TX_RING );
+
+    znet_uart_stats_t stats;
+    znet_ctx_uart_stats( ctx, &stats );
+    assert( stats.overflow == 1 && stats.written == 0 );
+}
+
+/// INFO: empty queue: uart takes what it can, the rest waits in the ring
+static void _test_split( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    uint8_t frame[100];
+    _test_frame( frame, sizeof( frame ), 9 );
+
+    test.room = 40;
+    assert( !znet_uart_write( ctx, frame, sizeof( frame ) ) );
+    assert( test.out_size == 40 && ctx->uart.tail - ctx->uart.head == 60 );
+
+    test.room = 100;
+    assert( !znet_uart_flush( ctx ) );
+    assert( test.out_size == sizeof( frame ) );
+    assert( !memcmp( test.out, frame, sizeof( frame ) ) );
+    assert( ctx->uart.written == sizeof( frame ) && ctx->uart.deferred == 60 );
+}
+
+/// INFO: uart may take less than the free space it reported, a frame bigger
+/// than the ring is not cut
+static void _test_short_write( void )
+{
+    znet_ctx_t* ctx = _test_setup();
+    uint8_t frame[ZNET_UART_TX_RING + 100];
+    _test_frame( frame, sizeof( frame ), 5 );
+
+    test.room = sizeof( frame );
+    test.accept = 100;
+    assert( znet_uart_write( ctx, frame, sizeof( frame ) ) == -1 );
+    assert( test.out_size == 0 && ctx->uart.head == ctx->uart.tail );
+
+    /// INFO: a frame that fits the ring goes whole, partly through the ring
+    assert( !znet_uart_write( ctx, frame, ZNET_UART_TX_RING ) );
+    assert( test.out_size == 100 );
+    assert( ctx->uart.tail - ctx->uart.head == ZNET_UART_TX_RING - 100 );
+}
+
+int main( void )
+{
+    _test_wrap();
+    _test_overflow();
+    _test_split();
+    _test_short_write();
+    printf( "znet_uart_test: OK\n" );
+    return 0;
+}